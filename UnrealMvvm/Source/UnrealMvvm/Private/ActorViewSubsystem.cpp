@@ -0,0 +1,117 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Mvvm/Impl/BaseView/ActorViewSubsystem.h"
+#include "Mvvm/BaseViewModel.h"
+#include "Engine/World.h"
+#include "UObject/UObjectGlobals.h"
+
+FActorViewEntry* FActorViewEntry::Request(AActor* Actor)
+{
+    if (Actor->HasAnyFlags(RF_ClassDefaultObject))
+    {
+        return nullptr;
+    }
+
+    UWorld* World = Actor->GetWorld();
+    UActorViewSubsystem* Subsystem = World ? World->GetSubsystem<UActorViewSubsystem>() : nullptr;
+
+    if (!Subsystem)
+    {
+        return nullptr;
+    }
+
+    TUniquePtr<FActorViewEntry>& Result = Subsystem->Entries.FindOrAdd(Actor);
+
+    if (!Result.IsValid())
+    {
+        Result = MakeUnique<FActorViewEntry>(Actor);
+        PrepareBindindsInternal(Actor, Result->BindingWorker);
+    }
+
+    return Result.Get();
+}
+
+FActorViewEntry* FActorViewEntry::Get(const AActor* Actor)
+{
+    UWorld* World = Actor->GetWorld();
+    UActorViewSubsystem* Subsystem = World ? World->GetSubsystem<UActorViewSubsystem>() : nullptr;
+
+    if (!Subsystem)
+    {
+        return nullptr;
+    }
+
+    TUniquePtr<FActorViewEntry>* Result = Subsystem->Entries.Find(Actor);
+    return Result ? Result->Get() : nullptr;
+}
+
+void FActorViewEntry::BeginPlay()
+{
+    // View is constructed, start listening and update current state
+    bConstructed = true;
+    InvokeStartListening(GetViewObject(), BindingWorker);
+}
+
+void FActorViewEntry::EndPlay()
+{
+    // View is no longer in play, stop listening to ViewModel
+    bConstructed = false;
+    BindingWorker.StopListening();
+}
+
+void UActorViewSubsystem::ViewBeginPlay(AActor* Actor)
+{
+    if (FActorViewEntry* Entry = FActorViewEntry::Request(Actor))
+    {
+        Entry->BeginPlay();
+    }
+}
+
+void UActorViewSubsystem::ViewEndPlay(AActor* Actor)
+{
+    if (FActorViewEntry* Entry = FActorViewEntry::Get(Actor))
+    {
+        Entry->EndPlay();
+    }
+}
+
+void UActorViewSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UActorViewSubsystem::RemoveStaleEntries);
+}
+
+void UActorViewSubsystem::Deinitialize()
+{
+    FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+
+    // workers stop listening when destroyed
+    Entries.Empty();
+
+    Super::Deinitialize();
+}
+
+void UActorViewSubsystem::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+    UActorViewSubsystem* This = CastChecked<UActorViewSubsystem>(InThis);
+
+    for (auto& Pair : This->Entries)
+    {
+        Collector.AddReferencedObject(Pair.Value->ViewModel);
+    }
+
+    Super::AddReferencedObjects(InThis, Collector);
+}
+
+void UActorViewSubsystem::RemoveStaleEntries()
+{
+    // Actors are not referenced by subsystem, their entries are dropped once they are collected
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        if (It.Key().ResolveObjectPtr() == nullptr)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
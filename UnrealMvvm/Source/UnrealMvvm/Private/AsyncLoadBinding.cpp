@@ -0,0 +1,31 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Mvvm/AsyncLoadBinding.h"
+#include "Engine/AssetManager.h"
+
+namespace UnrealMvvm_Impl
+{
+
+static TUniquePtr<FStreamableManager> ModuleStreamableManager;
+
+FStreamableManager& GetAsyncLoadStreamableManager()
+{
+    if (UAssetManager::IsInitialized())
+    {
+        return UAssetManager::GetStreamableManager();
+    }
+
+    if (!ModuleStreamableManager.IsValid())
+    {
+        ModuleStreamableManager = MakeUnique<FStreamableManager>();
+    }
+
+    return *ModuleStreamableManager;
+}
+
+void ShutdownAsyncLoadStreamableManager()
+{
+    ModuleStreamableManager.Reset();
+}
+
+}
@@ -0,0 +1,18 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Mvvm/BaseStructViewModel.h"
+
+FBaseStructViewModel::~FBaseStructViewModel()
+{
+    checkf(!HasConnectedViews(), TEXT("Struct ViewModel is destroyed while some Views are still bound to it"));
+}
+
+FBaseStructViewModel::FSubscribers& FBaseStructViewModel::GetOrCreateSubscribers()
+{
+    if (!Subscribers.IsValid())
+    {
+        Subscribers = MakeUnique<FSubscribers>();
+    }
+
+    return *Subscribers;
+}
@@ -1,5 +1,187 @@
 // Copyright Andrei Sudarikov. All Rights Reserved.
 
 #include "Mvvm/Impl/BaseView/BaseViewComponentImpl.h"
+#include "Mvvm/ValueConverters.h"
+#include "Misc/EngineVersionComparison.h"
+#include "UObject/UnrealType.h"
 
 FName UnrealMvvm_Impl::FBaseViewComponentImpl::ViewModelChangedFunctionName{ "OnVM_ViewModelChanged" };
+UnrealMvvm_Impl::FBlueprintDispatchBatch* UnrealMvvm_Impl::FBlueprintDispatchBatch::Current = nullptr;
+
+namespace UnrealMvvm_Impl
+{
+
+void WriteVisibility(FProperty* Target, void* TargetValue, ESlateVisibility Value)
+{
+    if (FEnumProperty* EnumTarget = CastField<FEnumProperty>(Target))
+    {
+        EnumTarget->GetUnderlyingProperty()->SetIntPropertyValue(TargetValue, (int64)Value);
+    }
+    else
+    {
+        CastFieldChecked<FByteProperty>(Target)->SetPropertyValue(TargetValue, (uint8)Value);
+    }
+}
+
+template <typename TNumber>
+void WritePercentText(FProperty* Target, void* TargetValue, const void* Value)
+{
+    // converter is created once, so formatting options are looked up only on first use
+    static const UnrealMvvm_Impl::FToPercentTextConverter Converter = MvvmConverters::ToPercentText();
+    CastFieldChecked<FTextProperty>(Target)->SetPropertyValue(TargetValue, Converter(*(const TNumber*)Value));
+}
+
+template <typename TNumber>
+void WriteNumber(FNumericProperty* Target, void* TargetValue, const void* Value)
+{
+    if (Target->IsFloatingPoint())
+    {
+        Target->SetFloatingPointPropertyValue(TargetValue, (double)*(const TNumber*)Value);
+    }
+    else
+    {
+        Target->SetIntPropertyValue(TargetValue, (int64)*(const TNumber*)Value);
+    }
+}
+
+FBlueprintDispatchBatch::~FBlueprintDispatchBatch()
+{
+    // handlers invoked by dispatched events are no longer part of initialization batch
+    Current = Previous;
+
+    for (FPendingDispatch& Dispatch : Pending)
+    {
+        // registry may grow while events are processed, so batch event is looked up right before the call
+        UFunction* BatchFunction = Dispatch.Indices.Num() > 1 ? FViewRegistry::GetBlueprintFunctions(View->GetClass()).DispatchBatchHandlers.FindRef(Dispatch.Function) : nullptr;
+        if (BatchFunction != nullptr)
+        {
+            // batch event takes indices of bindings as its only parameter
+            View->ProcessEvent(BatchFunction, &Dispatch.Indices);
+            continue;
+        }
+
+        // Blueprint may have been compiled without batch event, dispatch bindings one by one
+        for (int32 DispatchIndex : Dispatch.Indices)
+        {
+            View->ProcessEvent(Dispatch.Function, &DispatchIndex);
+        }
+    }
+}
+
+void FBlueprintDispatchBatch::Add(UFunction* DispatchFunction, int32 DispatchIndex)
+{
+    FPendingDispatch* Dispatch = Pending.FindByPredicate([&](const FPendingDispatch& Existing) { return Existing.Function == DispatchFunction; });
+    if (Dispatch == nullptr)
+    {
+        Dispatch = &Pending.Add_GetRef({ DispatchFunction });
+    }
+
+    Dispatch->Indices.Add(DispatchIndex);
+}
+
+bool FDirectPropertyChangeHandler::IsVisibilityProperty(const FProperty* Property)
+{
+    const UEnum* Enum = nullptr;
+
+    if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+    {
+        Enum = EnumProperty->GetEnum();
+    }
+    else if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
+    {
+        Enum = ByteProperty->Enum;
+    }
+
+    return Enum != nullptr && Enum == StaticEnum<ESlateVisibility>();
+}
+
+void FDirectPropertyChangeHandler::Invoke(UBaseViewModel* ViewModel, const FViewModelPropertyBase*) const
+{
+    const FViewRegistry::FPropertyBinding& Resolved = *Binding;
+    if (Resolved.Source == nullptr)
+    {
+        // binding is broken, View or ViewModel has changed after Blueprint was compiled
+        return;
+    }
+
+    // find object that owns target property
+    void* Container = BaseView;
+    const int32 LastIndex = Resolved.TargetPath.Num() - 1;
+
+    for (int32 Index = 0; Index < LastIndex; ++Index)
+    {
+        Container = CastFieldChecked<FObjectPropertyBase>(Resolved.TargetPath[Index])->GetObjectPropertyValue_InContainer(Container);
+        if (Container == nullptr)
+        {
+            return;
+        }
+    }
+
+    FProperty* Target = Resolved.TargetPath[LastIndex];
+
+    // value is prepared in a temporary of target type, so property setter is used if it has one
+    void* TargetValue = FMemory_Alloca_Aligned(Target->GetSize(), Target->GetMinAlignment());
+    Target->InitializeValue(TargetValue);
+
+    bool bHasValue = false;
+
+    if (Resolved.Conversion == EPropertyBindingConversion::None)
+    {
+        Resolved.Source->GetOperations().GetValue(ViewModel, TargetValue, bHasValue);
+    }
+    else
+    {
+        alignas(uint64) uint8 Value[sizeof(uint64)] = {};
+        Resolved.Source->GetOperations().GetValue(ViewModel, Value, bHasValue);
+
+        FNumericProperty* NumericTarget = CastField<FNumericProperty>(Target);
+
+        switch (Resolved.Conversion)
+        {
+        case EPropertyBindingConversion::FromBool:
+            CastFieldChecked<FBoolProperty>(Target)->SetPropertyValue(TargetValue, *(const bool*)Value);
+            break;
+        case EPropertyBindingConversion::FromByte:
+            WriteNumber<uint8>(NumericTarget, TargetValue, Value);
+            break;
+        case EPropertyBindingConversion::FromInt:
+            WriteNumber<int32>(NumericTarget, TargetValue, Value);
+            break;
+        case EPropertyBindingConversion::FromInt64:
+            WriteNumber<int64>(NumericTarget, TargetValue, Value);
+            break;
+        case EPropertyBindingConversion::FromFloat:
+            WriteNumber<float>(NumericTarget, TargetValue, Value);
+            break;
+        case EPropertyBindingConversion::FromDouble:
+            WriteNumber<double>(NumericTarget, TargetValue, Value);
+            break;
+        case EPropertyBindingConversion::BoolToVisibility:
+            WriteVisibility(Target, TargetValue, MvvmConverters::ToVisibility()(*(const bool*)Value));
+            break;
+        case EPropertyBindingConversion::FloatToPercentText:
+            WritePercentText<float>(Target, TargetValue, Value);
+            break;
+        case EPropertyBindingConversion::DoubleToPercentText:
+            WritePercentText<double>(Target, TargetValue, Value);
+            break;
+        default:
+            checkNoEntry();
+            break;
+        }
+    }
+
+    // unset optional keeps previous value of target property
+    if (bHasValue)
+    {
+#if UE_VERSION_OLDER_THAN(5,1,0)
+        Target->CopyCompleteValue(Target->ContainerPtrToValuePtr<void>(Container), TargetValue);
+#else
+        Target->SetValue_InContainer(Container, TargetValue);
+#endif
+    }
+
+    Target->DestroyValue(TargetValue);
+}
+
+}
@@ -0,0 +1,231 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Mvvm/BaseViewModel.h"
+#include "Mvvm/ViewModelTickManager.h"
+#include "Mvvm/Impl/Property/ViewModelRegistry.h"
+#include "UObject/UObjectArray.h"
+#include "UObject/UnrealType.h"
+
+namespace UnrealMvvm_Impl
+{
+
+/* Invokes Func for all objects of a cluster, including its root */
+template <typename TFunc>
+void ForEachObjectInCluster(const FUObjectCluster& Cluster, TFunc&& Func)
+{
+    Func(static_cast<UObject*>(GUObjectArray.IndexToObject(Cluster.RootIndex)->Object));
+    for (int32 ObjectIndex : Cluster.Objects)
+    {
+        Func(static_cast<UObject*>(GUObjectArray.IndexToObject(ObjectIndex)->Object));
+    }
+}
+
+/* Invokes Func for all ViewModels of a cluster, including its root */
+template <typename TFunc>
+void ForEachViewModelInCluster(const FUObjectCluster& Cluster, TFunc&& Func)
+{
+    ForEachObjectInCluster(Cluster, [&Func](UObject* Object)
+    {
+        if (UBaseViewModel* ViewModel = Cast<UBaseViewModel>(Object))
+        {
+            Func(ViewModel);
+        }
+    });
+}
+
+/* Returns whether every strong object reference of Object is held by a ViewModel property, so changing it raises notification. Objects other than ViewModels have no such properties */
+bool HasOnlyNotifyingReferences(UObject* Object)
+{
+    UClass* Class = Object->GetClass();
+    const bool bIsViewModel = Class->IsChildOf<UBaseViewModel>();
+
+    for (TFieldIterator<FProperty> It(Class); It; ++It)
+    {
+        TArray<const FStructProperty*> EncounteredStructProps;
+        if (It->ContainsObjectReference(EncounteredStructProps) && (!bIsViewModel || FViewModelRegistry::FindProperty(Class, It->GetFName()) == nullptr))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}
+
+UBaseViewModel::FSubscriptionState& UBaseViewModel::GetOrCreateSubscriptionState()
+{
+    if (!SubscriptionState.IsValid())
+    {
+        // never released until ViewModel is destroyed, because it may be in the middle of broadcast
+        SubscriptionState = MakeUnique<FSubscriptionState>();
+    }
+
+    return *SubscriptionState;
+}
+
+FDelegateHandle UBaseViewModel::Subscribe(FPropertyChangedDelegate::FDelegate&& Callback)
+{
+    FSubscriptionState& State = GetOrCreateSubscriptionState();
+
+    if (!State.DelegateHandle.IsValid())
+    {
+        State.DelegateHandle = Subscribe(&State, &UBaseViewModel::BroadcastDelegate);
+    }
+
+    return State.Delegate.Add(MoveTemp(Callback));
+}
+
+void UBaseViewModel::Unsubscribe(FDelegateHandle Handle)
+{
+    if (SubscriptionState.IsValid() && SubscriptionState->DelegateHandle.IsValid())
+    {
+        SubscriptionState->Delegate.Remove(Handle);
+        RemoveDelegateSubscriberIfUnbound();
+    }
+}
+
+void UBaseViewModel::Unsubscribe(const void* InUserObject)
+{
+    if (!SubscriptionState.IsValid())
+    {
+        return;
+    }
+
+    FSubscriptionState& State = *SubscriptionState;
+    const bool bWasSubscribed = State.Subscribers.Num() > 0;
+
+    if (State.DelegateHandle.IsValid())
+    {
+        State.Delegate.RemoveAll(InUserObject);
+
+        if (!State.Delegate.IsBound())
+        {
+            State.Subscribers.Remove(State.DelegateHandle);
+            State.DelegateHandle.Reset();
+        }
+    }
+
+    State.Subscribers.RemoveAll(InUserObject);
+
+    if (bWasSubscribed && State.Subscribers.Num() == 0)
+    {
+        NotifySubscriptionStatusChanged(false);
+    }
+}
+
+void UBaseViewModel::BroadcastDelegate(void* Owner, UBaseViewModel* ViewModel, const FViewModelPropertyBase* Property)
+{
+    static_cast<FSubscriptionState*>(Owner)->Delegate.Broadcast(Property);
+}
+
+void UBaseViewModel::RemoveDelegateSubscriberIfUnbound()
+{
+    if (!SubscriptionState->Delegate.IsBound())
+    {
+        const FSubscriptionHandle Handle = SubscriptionState->DelegateHandle;
+        SubscriptionState->DelegateHandle.Reset();
+        Unsubscribe(Handle);
+    }
+}
+
+void UBaseViewModel::SetTickRate(EViewModelTickRate InTickRate)
+{
+    check(IsInGameThread());
+    check(InTickRate < EViewModelTickRate::Num);
+
+    if (TickRate == InTickRate)
+    {
+        return;
+    }
+
+    if (TickRate != EViewModelTickRate::None && HasConnectedViews())
+    {
+        FViewModelTickManager::Get().Remove(this, TickRate);
+    }
+
+    TickRate = InTickRate;
+
+    if (TickRate != EViewModelTickRate::None && HasConnectedViews())
+    {
+        FViewModelTickManager::Get().Add(this, TickRate);
+    }
+}
+
+void UBaseViewModel::UpdateTickRegistration(bool bHasConnectedViews)
+{
+    if (bHasConnectedViews)
+    {
+        FViewModelTickManager::Get().Add(this, TickRate);
+    }
+    else
+    {
+        FViewModelTickManager::Get().Remove(this, TickRate);
+    }
+}
+
+bool UBaseViewModel::CreateViewModelCluster()
+{
+    check(IsInGameThread());
+
+    if (GUObjectClusters.GetObjectCluster(this) != nullptr)
+    {
+        // already in a cluster
+        return false;
+    }
+
+    // cluster is collected using class token streams, so properties registered in FViewModelRegistry are followed too
+    CreateCluster();
+
+    FUObjectCluster* Cluster = GUObjectClusters.GetObjectCluster(this);
+    if (Cluster == nullptr)
+    {
+        return false;
+    }
+
+    // changes of references that are not ViewModel properties are never noticed, such cluster would hide newly referenced objects from GC.
+    // this includes plain objects referenced from ViewModel properties, their own references may change without any notification
+    bool bAllNotifying = true;
+    UnrealMvvm_Impl::ForEachObjectInCluster(*Cluster, [&bAllNotifying](UObject* Object) { bAllNotifying &= UnrealMvvm_Impl::HasOnlyNotifyingReferences(Object); });
+
+    if (!bAllNotifying)
+    {
+        GUObjectClusters.DissolveCluster(this);
+        return false;
+    }
+
+    UnrealMvvm_Impl::ForEachViewModelInCluster(*Cluster, [](UBaseViewModel* ViewModel) { ViewModel->bInCluster = true; });
+    return true;
+}
+
+bool UBaseViewModel::IsInViewModelCluster() const
+{
+    // GC dissolves clusters on its own, e.g. when one of clustered objects is marked as garbage
+    return bInCluster && GUObjectClusters.GetObjectCluster(const_cast<UBaseViewModel*>(this)) != nullptr;
+}
+
+void UBaseViewModel::DissolveViewModelCluster()
+{
+    check(IsInGameThread());
+
+    if (FUObjectCluster* Cluster = GUObjectClusters.GetObjectCluster(this))
+    {
+        UnrealMvvm_Impl::ForEachViewModelInCluster(*Cluster, [](UBaseViewModel* ViewModel) { ViewModel->bInCluster = false; });
+        GUObjectClusters.DissolveCluster(this);
+    }
+
+    // cluster may have been already dissolved by GC
+    bInCluster = false;
+}
+
+void UBaseViewModel::DissolveClusterIfReferencesChanged(const FViewModelPropertyBase* Property)
+{
+    // objects referenced after cluster was created are not known to GC, so cluster must be dissolved
+    using namespace UnrealMvvm_Impl;
+    const FViewModelPropertyReflection* Reflection = FViewModelRegistry::FindProperty(GetClass(), Property->GetName());
+
+    if (Reflection == nullptr || Reflection->GetOperations().ContainsObjectReference(false))
+    {
+        DissolveViewModelCluster();
+    }
+}
@@ -26,7 +26,8 @@ void FBindingConfigurationBuilder::AddBinding(TArrayView<const FViewModelPropert
         const FViewModelPropertyReflection* Reflection = FViewModelRegistry::FindProperty(CurrentViewModelClass, PropertyPath[PropertyIndex]->GetName());
         if (Reflection == nullptr)
         {
-            // ignore whole binding if it has invalid entry
+            // ignore whole binding if it has invalid entry, but keep indices of following bindings intact
+            NumBindings++;
             return;
         }
 
@@ -51,7 +52,8 @@ void FBindingConfigurationBuilder::AddBinding(TArrayView<const FName> PropertyPa
         const FViewModelPropertyReflection* Reflection = FViewModelRegistry::FindProperty(CurrentViewModelClass, PropertyPath[PropertyIndex]);
         if (Reflection == nullptr)
         {
-            // ignore whole binding if it has invalid entry
+            // ignore whole binding if it has invalid entry, but keep indices of following bindings intact
+            NumBindings++;
             return;
         }
 
@@ -82,12 +84,17 @@ void FBindingConfigurationBuilder::AddBinding(TArrayView<const FViewModelPropert
         CurrentNode = NewNode;
     }
 
-    check(!CurrentNode->bHandlerExpected);
-    CurrentNode->bHandlerExpected = true;
+    check(CurrentNode->BindingIndex == INDEX_NONE);
+    CurrentNode->BindingIndex = NumBindings++;
 }
 
-FBindingConfiguration FBindingConfigurationBuilder::Build()
+FBindingConfiguration FBindingConfigurationBuilder::Build(TArray<int32>* OutHandlerSlots, TArray<int32>* OutParentProperties)
 {
+    if (OutHandlerSlots != nullptr)
+    {
+        OutHandlerSlots->Init(INDEX_NONE, NumBindings);
+    }
+
     // queue for breadth-first tree iteration
     TResizableCircularQueue<TTuple<FBindingTreeNode*, int32>> Queue;
 
@@ -119,6 +126,11 @@ FBindingConfiguration FBindingConfigurationBuilder::Build()
         return FBindingConfiguration();
     }
 
+    if (OutParentProperties != nullptr)
+    {
+        OutParentProperties->Init(INDEX_NONE, NumProperties);
+    }
+
     // allocate memory for all entries and initialize it
     FBindingConfiguration Result(NumViewModels, NumProperties);
 
@@ -150,6 +162,17 @@ FBindingConfiguration FBindingConfigurationBuilder::Build()
                 Queue.Enqueue(MakeTuple(&Node, NextPropertyIndex));
             }
 
+            if (OutHandlerSlots != nullptr && Node.BindingIndex != INDEX_NONE)
+            {
+                (*OutHandlerSlots)[Node.BindingIndex] = NextPropertyIndex;
+            }
+
+            if (OutParentProperties != nullptr)
+            {
+                // property entry that referenced current ViewModel, INDEX_NONE for Main ViewModel
+                (*OutParentProperties)[NextPropertyIndex] = CurrentNode.Value;
+            }
+
             Properties[NextPropertyIndex] = FResolvedPropertyEntry(Node.Property, INDEX_NONE);
             NextPropertyIndex++;
         }
@@ -2,16 +2,37 @@
 
 #include "Mvvm/Impl/Binding/BindingWorker.h"
 #include "Mvvm/Impl/Binding/IPropertyChangeHandler.h"
+#include "Mvvm/Impl/Binding/TextFormattingCache.h"
 #include "Mvvm/Impl/BaseView/ViewChangeTracker.h"
 #include "Mvvm/Impl/Property/ViewModelRegistry.h"
+#include "Containers/Ticker.h"
+#include "HAL/PlatformTime.h"
 
 namespace UnrealMvvm_Impl
 {
 
+FBindingWorker::FHandlerSlotsScope* FBindingWorker::FHandlerSlotsScope::Current = nullptr;
+
+// head of the list of Workers that are currently listening to their ViewModels. Worker unlinks itself in StopListening, which is also called by destructor
+static FBindingWorker* ListeningWorkers = nullptr;
+
+// next Worker waiting for its text bindings to be refreshed. Workers are added to the head of the list,
+// so those that start listening during refresh are not visited, they set their texts in StartListening anyway
+static FBindingWorker* NextTextRefresh = nullptr;
+static double TextRefreshBudget = 0.0;
+static FTSTicker::FDelegateHandle TextRefreshTicker;
+
 void FBindingWorker::Init(UObject* InOwningView, const FBindingConfiguration& ConfigurationTemplate)
 {
     OwningView = InOwningView;
+
+    // flags set before Init belong to this instance, template does not carry them
+    const bool bDiffRebind = Bindings.IsDiffRebind();
+    const bool bDiffPropagation = Bindings.IsDiffPropagation();
+
     Bindings = ConfigurationTemplate;
+    Bindings.SetDiffRebind(bDiffRebind);
+    Bindings.SetDiffPropagation(bDiffPropagation);
 
     for (FResolvedViewModelEntry& ViewModelEntry : Bindings.GetViewModels())
     {
@@ -29,6 +50,13 @@ void FBindingWorker::StartListening()
 
     Bindings.SetHasSubscription(true);
 
+    NextListening = ListeningWorkers;
+    if (NextListening != nullptr)
+    {
+        NextListening->PrevListening = this;
+    }
+    ListeningWorkers = this;
+
     TArrayView<FResolvedViewModelEntry> ViewModelEntries = Bindings.GetViewModels();
 
     // subscribe to existing ViewModels
@@ -42,7 +70,7 @@ void FBindingWorker::StartListening()
             continue;
         }
 
-        Subscribe(ViewModelEntry.ViewModel);
+        Subscribe(ViewModelEntry);
 
         TArrayView<FResolvedPropertyEntry> PropertyEntries = Bindings.GetProperties(ViewModelEntry);
         for (const FResolvedPropertyEntry& PropertyEntry : PropertyEntries)
@@ -71,6 +99,28 @@ void FBindingWorker::StopListening()
 
     Bindings.SetHasSubscription(false);
 
+    if (NextTextRefresh == this)
+    {
+        NextTextRefresh = NextListening;
+    }
+
+    if (PrevListening != nullptr)
+    {
+        PrevListening->NextListening = NextListening;
+    }
+    else
+    {
+        ListeningWorkers = NextListening;
+    }
+
+    if (NextListening != nullptr)
+    {
+        NextListening->PrevListening = PrevListening;
+    }
+
+    PrevListening = nullptr;
+    NextListening = nullptr;
+
     TArrayView<FResolvedViewModelEntry> ViewModelEntries = Bindings.GetViewModels();
 
     // unsubscribe from existing ViewModels
@@ -79,7 +129,7 @@ void FBindingWorker::StopListening()
         FResolvedViewModelEntry& ViewModelEntry = ViewModelEntries[Index];
         if (ViewModelEntry.ViewModel != nullptr)
         {
-            ViewModelEntry.ViewModel->Unsubscribe(this);
+            Unsubscribe(ViewModelEntry);
 
             // clear all entries except the first one
             if (Index > 0)
@@ -92,6 +142,98 @@ void FBindingWorker::StopListening()
     // TODO: check if there are properties that explicitly handle "no value" and invoke their handlers
 }
 
+void FBindingWorker::RebindViewModel(UBaseViewModel* InViewModel)
+{
+    UBaseViewModel* OldViewModel = GetViewModel();
+
+    if (!Bindings.HasSubscription() || OldViewModel == nullptr || InViewModel == nullptr)
+    {
+        // nothing to compare with, do a full rebind
+        StopListening();
+        SetViewModel(InViewModel);
+        StartListening();
+        return;
+    }
+
+    TArrayView<FResolvedViewModelEntry> ViewModelEntries = Bindings.GetViewModels();
+
+    // remember current ViewModels, we need them to compare values
+    TArray<UBaseViewModel*, TInlineAllocator<16>> OldViewModels;
+    TArray<FViewModelSubscriptionHandle, TInlineAllocator<16>> OldHandles;
+    OldViewModels.Reserve(ViewModelEntries.Num());
+    OldHandles.Reserve(ViewModelEntries.Num());
+    for (const FResolvedViewModelEntry& ViewModelEntry : ViewModelEntries)
+    {
+        OldViewModels.Add(ViewModelEntry.ViewModel);
+        OldHandles.Add(ViewModelEntry.SubscriptionHandle);
+    }
+
+    // resolve new ViewModels
+    // entries are stored breadth-first, so parent entry is always processed before its children
+    // children of unchanged entry keep their ViewModels, because they are taken from the same instance
+    ViewModelEntries[0].ViewModel = InViewModel;
+    for (int32 Index = 0; Index < ViewModelEntries.Num(); ++Index)
+    {
+        UBaseViewModel* ViewModel = ViewModelEntries[Index].ViewModel;
+        if (ViewModel == OldViewModels[Index])
+        {
+            continue;
+        }
+
+        for (const FResolvedPropertyEntry& PropertyEntry : Bindings.GetProperties(ViewModelEntries[Index]))
+        {
+            if (PropertyEntry.NextViewModelIndex != INDEX_NONE)
+            {
+                ViewModelEntries[PropertyEntry.NextViewModelIndex].ViewModel = GetViewModelFromProperty(ViewModel, PropertyEntry.Property);
+            }
+        }
+    }
+
+    // update subscriptions of changed entries
+    // subscribe everything first, so ViewModel moved between entries does not lose its last subscriber in the middle
+    for (int32 Index = 0; Index < ViewModelEntries.Num(); ++Index)
+    {
+        FResolvedViewModelEntry& ViewModelEntry = ViewModelEntries[Index];
+        if (ViewModelEntry.ViewModel != OldViewModels[Index])
+        {
+            ViewModelEntry.SubscriptionHandle.Reset();
+
+            if (ViewModelEntry.ViewModel != nullptr)
+            {
+                Subscribe(ViewModelEntry);
+            }
+        }
+    }
+
+    for (int32 Index = 0; Index < ViewModelEntries.Num(); ++Index)
+    {
+        if (ViewModelEntries[Index].ViewModel != OldViewModels[Index] && OldHandles[Index].IsValid())
+        {
+            OldViewModels[Index]->Unsubscribe(OldHandles[Index]);
+        }
+    }
+
+    // invoke handlers of changed values
+    for (int32 Index = 0; Index < ViewModelEntries.Num(); ++Index)
+    {
+        UBaseViewModel* ViewModel = ViewModelEntries[Index].ViewModel;
+        if (ViewModel == nullptr || ViewModel == OldViewModels[Index])
+        {
+            continue;
+        }
+
+        for (const FResolvedPropertyEntry& PropertyEntry : Bindings.GetProperties(ViewModelEntries[Index]))
+        {
+            // property may have no handler if it is used only inside "property path" binding
+            IPropertyChangeHandler* Handler = PropertyEntry.GetHandler();
+            if (Handler != nullptr && !HasEqualValues(OldViewModels[Index], ViewModel, PropertyEntry.Property))
+            {
+                Handler->Invoke(ViewModel, PropertyEntry.Property);
+            }
+        }
+    }
+}
+
 void FBindingWorker::OnPropertyChanged(const FViewModelPropertyBase* Property, UBaseViewModel* ViewModel)
 {
     TArrayView<FResolvedViewModelEntry> ViewModelEntries = Bindings.GetViewModels();
@@ -109,7 +251,7 @@ void FBindingWorker::OnPropertyChanged(const FViewModelPropertyBase* Property, U
     }
 }
 
-void FBindingWorker::ProcessPropertyChange(UBaseViewModel* ViewModel, const FResolvedPropertyEntry& PropertyEntry)
+void FBindingWorker::ProcessPropertyChange(UBaseViewModel* ViewModel, const FResolvedPropertyEntry& PropertyEntry, UBaseViewModel* PreviousViewModel)
 {
     if (PropertyEntry.NextViewModelIndex != INDEX_NONE)
     {
@@ -120,37 +262,130 @@ void FBindingWorker::ProcessPropertyChange(UBaseViewModel* ViewModel, const FRes
 
         if (CurrentViewModel != CachedViewModel)
         {
-            ViewModelEntry.ViewModel = CurrentViewModel;
-
             if (CachedViewModel != nullptr)
             {
-                CachedViewModel->Unsubscribe(this);
+                Unsubscribe(ViewModelEntry);
             }
 
+            ViewModelEntry.ViewModel = CurrentViewModel;
+
             if (CurrentViewModel != nullptr)
             {
-                Subscribe(CurrentViewModel);
+                Subscribe(ViewModelEntry);
             }
 
             // propagate changes of all properties
-            PropagateChanges(ViewModelEntry);
+            PropagateChanges(ViewModelEntry, CachedViewModel);
         }
     }
 
     // property may have no handler if it is used only inside "property path" binding
-    if (IPropertyChangeHandler* Handler = PropertyEntry.GetHandler())
+    IPropertyChangeHandler* Handler = PropertyEntry.GetHandler();
+    if (Handler != nullptr && !HasEqualValues(PreviousViewModel, ViewModel, PropertyEntry.Property))
     {
         UnrealMvvm_Impl::FViewChangeScope Scope(OwningView, ViewModel, PropertyEntry.Property);
         Handler->Invoke(ViewModel, PropertyEntry.Property);
     }
 }
 
-void FBindingWorker::PropagateChanges(const FResolvedViewModelEntry& ViewModelEntry)
+void FBindingWorker::PropagateChanges(const FResolvedViewModelEntry& ViewModelEntry, UBaseViewModel* PreviousViewModel)
 {
+    if (!Bindings.IsDiffPropagation())
+    {
+        // invoke all handlers regardless of values
+        PreviousViewModel = nullptr;
+    }
+
     TArrayView<FResolvedPropertyEntry> PropertyEntries = Bindings.GetProperties(ViewModelEntry);
     for (const FResolvedPropertyEntry& PropertyEntry : PropertyEntries)
     {
-        ProcessPropertyChange(ViewModelEntry.ViewModel, PropertyEntry);
+        ProcessPropertyChange(ViewModelEntry.ViewModel, PropertyEntry, PreviousViewModel);
+    }
+}
+
+void FBindingWorker::RefreshTextBindings(double MaxSecondsPerFrame)
+{
+    check(IsInGameThread());
+
+    // makes text bindings ignore their last values, so Workers that start listening later set their texts as well
+    FNumberTextCache::Invalidate();
+
+    NextTextRefresh = ListeningWorkers;
+    TextRefreshBudget = MaxSecondsPerFrame;
+
+    if (!ProcessTextBindingsRefresh(TextRefreshBudget))
+    {
+        if (!TextRefreshTicker.IsValid())
+        {
+            TextRefreshTicker = FTSTicker::GetCoreTicker().AddTicker(TEXT("RefreshTextBindings"), 0.f, [](float)
+            {
+                if (ProcessTextBindingsRefresh(TextRefreshBudget))
+                {
+                    return true;
+                }
+
+                TextRefreshTicker.Reset();
+                return false;
+            });
+        }
+    }
+}
+
+bool FBindingWorker::IsRefreshingTextBindings()
+{
+    return NextTextRefresh != nullptr;
+}
+
+void FBindingWorker::CancelTextBindingsRefresh()
+{
+    NextTextRefresh = nullptr;
+
+    if (TextRefreshTicker.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TextRefreshTicker);
+        TextRefreshTicker.Reset();
+    }
+}
+
+bool FBindingWorker::ProcessTextBindingsRefresh(double MaxSeconds)
+{
+    const double EndTime = MaxSeconds > 0.0 ? FPlatformTime::Seconds() + MaxSeconds : 0.0;
+
+    while (NextTextRefresh != nullptr)
+    {
+        // advance first, handlers may stop listening of this or other Workers
+        FBindingWorker* Worker = NextTextRefresh;
+        NextTextRefresh = Worker->NextListening;
+
+        Worker->InvokeTextHandlers();
+
+        if (EndTime > 0.0 && FPlatformTime::Seconds() >= EndTime)
+        {
+            break;
+        }
+    }
+
+    return NextTextRefresh != nullptr;
+}
+
+void FBindingWorker::InvokeTextHandlers()
+{
+    for (const FResolvedViewModelEntry& ViewModelEntry : Bindings.GetViewModels())
+    {
+        if (ViewModelEntry.ViewModel == nullptr)
+        {
+            continue;
+        }
+
+        for (const FResolvedPropertyEntry& PropertyEntry : Bindings.GetProperties(ViewModelEntry))
+        {
+            IPropertyChangeHandler* Handler = PropertyEntry.GetHandler();
+            if (Handler != nullptr && Handler->IsTextBinding())
+            {
+                UnrealMvvm_Impl::FViewChangeScope Scope(OwningView, ViewModelEntry.ViewModel, PropertyEntry.Property);
+                Handler->Invoke(ViewModelEntry.ViewModel, PropertyEntry.Property);
+            }
+        }
     }
 }
 
@@ -179,4 +414,15 @@ UBaseViewModel* FBindingWorker::GetViewModelFromProperty(UBaseViewModel* ViewMod
     return nullptr;
 }
 
+bool FBindingWorker::HasEqualValues(UBaseViewModel* First, UBaseViewModel* Second, const FViewModelPropertyBase* Property)
+{
+    if (First == nullptr || Second == nullptr)
+    {
+        return false;
+    }
+
+    const FViewModelPropertyReflection* Reflection = FViewModelRegistry::FindProperty(Second->GetClass(), Property->GetName());
+    return Reflection != nullptr && Reflection->GetOperations().HasEqualValues(First, Second);
+}
+
 }
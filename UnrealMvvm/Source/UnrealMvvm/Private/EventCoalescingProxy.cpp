@@ -0,0 +1,71 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Mvvm/Impl/ListenManager/EventCoalescingProxy.h"
+#include "UObject/Package.h"
+#include "UObject/UnrealType.h"
+
+namespace UnrealMvvm_Impl
+{
+
+class FDynamicEventCoalescer : public FDynamicEventCoalescerBase
+{
+public:
+    FDynamicEventCoalescer(const FEventCoalescingOptions& Options, UObject* InListener, UFunction* InFunction)
+        : FDynamicEventCoalescerBase(Options)
+        , Listener(InListener)
+        , Function(InFunction)
+    {
+        Params = (uint8*)FMemory::Malloc(FMath::Max(Function->ParmsSize, 1), Function->GetMinAlignment());
+        Function->InitializeStruct(Params);
+    }
+
+    ~FDynamicEventCoalescer()
+    {
+        Function->DestroyStruct(Params);
+        FMemory::Free(Params);
+    }
+
+    void Push(const void* InParams) override
+    {
+        // event signature matches signature of Listener function, so parameters layout is the same
+        for (TFieldIterator<FProperty> It(Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+        {
+            It->CopyCompleteValue_InContainer(Params, InParams);
+        }
+
+        bPending = true;
+        Schedule();
+    }
+
+protected:
+    void Flush() override
+    {
+        if (bPending)
+        {
+            bPending = false;
+
+            if (UObject* ListenerPtr = Listener.Get())
+            {
+                ListenerPtr->ProcessEvent(Function, Params);
+            }
+        }
+    }
+
+private:
+    TWeakObjectPtr<UObject> Listener;
+    UFunction* Function;
+    uint8* Params = nullptr;
+    bool bPending = false;
+};
+
+}
+
+UEventCoalescingProxy* UEventCoalescingProxy::Create(UObject* Listener, FName FunctionName, const UnrealMvvm_Impl::FEventCoalescingOptions& Options)
+{
+    check(Listener);
+
+    UEventCoalescingProxy* Proxy = NewObject<UEventCoalescingProxy>(GetTransientPackage());
+    Proxy->Start(MakeShared<UnrealMvvm_Impl::FDynamicEventCoalescer>(Options, Listener, Listener->FindFunctionChecked(FunctionName)));
+
+    return Proxy;
+}
@@ -0,0 +1,23 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Mvvm/Impl/ListenManager/EventForwardingProxy.h"
+
+void UEventForwardingProxy::Start(TSharedRef<UnrealMvvm_Impl::FDynamicEventCoalescerBase> InCoalescer)
+{
+    Coalescer = MoveTemp(InCoalescer);
+    AddToRoot();
+}
+
+void UEventForwardingProxy::Release()
+{
+    Coalescer.Reset();
+    RemoveFromRoot();
+}
+
+void UEventForwardingProxy::ProcessEvent(UFunction* Function, void* Parms)
+{
+    if (Coalescer.IsValid())
+    {
+        Coalescer->Push(Parms);
+    }
+}
@@ -3,6 +3,7 @@
 #include "Mvvm/MvvmStatics.h"
 #include "Mvvm/Impl/BaseView/BaseViewExtension.h"
 #include "Mvvm/Impl/BaseView/BaseViewComponent.h"
+#include "Mvvm/Impl/BaseView/ActorViewSubsystem.h"
 #include "Mvvm/Impl/BaseView/ViewChangeTracker.h"
 #include "Mvvm/Impl/BaseView/ViewRegistry.h"
 #include "Mvvm/Impl/Property/ViewModelRegistry.h"
@@ -18,6 +19,12 @@ TSubclassOf<UBaseViewModel> UMvvmStatics::GetViewModelClass(UClass* ViewClass)
     return UnrealMvvm_Impl::FViewRegistry::GetViewModelClass(ViewClass);;
 }
 
+// Views with EActorViewStorage::Subsystem have no component, their bindings are stored in UActorViewSubsystem
+static bool UsesActorViewSubsystem(AActor* View)
+{
+    return View && UnrealMvvm_Impl::FViewRegistry::UsesActorViewSubsystem(View->GetClass());
+}
+
 UBaseViewModel* UMvvmStatics::GetViewModelFromWidget(UUserWidget* View)
 {
     return GetViewModelInternal<UUserWidget, UBaseViewExtension>(View);
@@ -25,6 +32,11 @@ UBaseViewModel* UMvvmStatics::GetViewModelFromWidget(UUserWidget* View)
 
 UBaseViewModel* UMvvmStatics::GetViewModelFromActor(AActor* View)
 {
+    if (UsesActorViewSubsystem(View))
+    {
+        return GetViewModelInternal<AActor, FActorViewEntry>(View);
+    }
+
     return GetViewModelInternal<AActor, UBaseViewComponent>(View);
 }
 
@@ -35,9 +47,52 @@ void UMvvmStatics::SetViewModelToWidget(UUserWidget* View, UBaseViewModel* ViewM
 
 void UMvvmStatics::SetViewModelToActor(AActor* View, UBaseViewModel* ViewModel)
 {
+    if (UsesActorViewSubsystem(View))
+    {
+        SetViewModelInternal<AActor, FActorViewEntry>(View, ViewModel);
+        return;
+    }
+
     SetViewModelInternal<AActor, UBaseViewComponent>(View, ViewModel);
 }
 
+void UMvvmStatics::SetDiffRebindEnabledInWidget(UUserWidget* View, bool bEnabled)
+{
+    SetDiffRebindEnabledInternal<UUserWidget, UBaseViewExtension>(View, bEnabled);
+}
+
+void UMvvmStatics::SetDiffRebindEnabledInActor(AActor* View, bool bEnabled)
+{
+    if (UsesActorViewSubsystem(View))
+    {
+        SetDiffRebindEnabledInternal<AActor, FActorViewEntry>(View, bEnabled);
+        return;
+    }
+
+    SetDiffRebindEnabledInternal<AActor, UBaseViewComponent>(View, bEnabled);
+}
+
+void UMvvmStatics::SetDiffPropagationEnabledInWidget(UUserWidget* View, bool bEnabled)
+{
+    SetDiffPropagationEnabledInternal<UUserWidget, UBaseViewExtension>(View, bEnabled);
+}
+
+void UMvvmStatics::SetDiffPropagationEnabledInActor(AActor* View, bool bEnabled)
+{
+    if (UsesActorViewSubsystem(View))
+    {
+        SetDiffPropagationEnabledInternal<AActor, FActorViewEntry>(View, bEnabled);
+        return;
+    }
+
+    SetDiffPropagationEnabledInternal<AActor, UBaseViewComponent>(View, bEnabled);
+}
+
+void UMvvmStatics::RefreshTextBindings(float MaxMillisecondsPerFrame)
+{
+    UnrealMvvm_Impl::FBindingWorker::RefreshTextBindings(FMath::Max(MaxMillisecondsPerFrame, 0.f) / 1000.0);
+}
+
 bool UMvvmStatics::IsInitializingPropertyInWidget(UUserWidget* View)
 {
     return UnrealMvvm_Impl::FViewChangeTracker::IsInitializing(View);
@@ -257,7 +312,56 @@ void UMvvmStatics::SetViewModelInternal(TView* View, UBaseViewModel* ViewModel)
     }
     else
     {
-        TViewComponent* Component = TViewComponent::Request(View);
-        Component->SetViewModelInternal(ViewModel);
+        // Request returns nullptr for CDOs and for Actors without UActorViewSubsystem
+        if (TViewComponent* Component = TViewComponent::Request(View))
+        {
+            Component->SetViewModelInternal(ViewModel);
+        }
+    }
+}
+
+template <typename TView, typename TViewComponent>
+void UMvvmStatics::SetDiffRebindEnabledInternal(TView* View, bool bEnabled)
+{
+    using namespace UnrealMvvm_Impl;
+
+    if (!ensureAlways(View))
+    {
+        return;
+    }
+
+    if (!FViewRegistry::GetViewModelClass(View->GetClass()))
+    {
+        // This Object is not a View, nothing to do here
+        return;
+    }
+
+    // Request returns nullptr for CDOs and for Actors without UActorViewSubsystem
+    if (TViewComponent* Component = TViewComponent::Request(View))
+    {
+        Component->BindingWorker.SetDiffRebindEnabled(bEnabled);
+    }
+}
+
+template <typename TView, typename TViewComponent>
+void UMvvmStatics::SetDiffPropagationEnabledInternal(TView* View, bool bEnabled)
+{
+    using namespace UnrealMvvm_Impl;
+
+    if (!ensureAlways(View))
+    {
+        return;
+    }
+
+    if (!FViewRegistry::GetViewModelClass(View->GetClass()))
+    {
+        // This Object is not a View, nothing to do here
+        return;
+    }
+
+    // Request returns nullptr for CDOs and for Actors without UActorViewSubsystem
+    if (TViewComponent* Component = TViewComponent::Request(View))
+    {
+        Component->BindingWorker.SetDiffPropagationEnabled(bEnabled);
     }
 }
@@ -0,0 +1,70 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Mvvm/Impl/Binding/TextFormattingCache.h"
+
+namespace UnrealMvvm_Impl
+{
+
+// starts from one, text bindings treat zero as "no text was set yet"
+static uint32 TextGeneration = 1;
+
+TArray<FNumberTextCache::FFormat>& FNumberTextCache::GetFormats()
+{
+    static TArray<FFormat> Formats;
+    return Formats;
+}
+
+int32 FNumberTextCache::GetFormatIndex(const FNumberFormattingOptions* Options, const FCulturePtr& TargetCulture)
+{
+    check(IsInGameThread());
+
+    TArray<FFormat>& Formats = GetFormats();
+
+    // number of distinct formatting options used by bindings is small, so linear search is fine
+    const int32 Index = Formats.IndexOfByPredicate([&](const FFormat& Format)
+    {
+        if (Format.TargetCulture != TargetCulture || Format.Options.IsSet() != (Options != nullptr))
+        {
+            return false;
+        }
+
+        return Options == nullptr || Format.Options->IsIdentical(*Options);
+    });
+
+    if (Index != INDEX_NONE)
+    {
+        return Index;
+    }
+
+    FFormat& Format = Formats.AddDefaulted_GetRef();
+    Format.TargetCulture = TargetCulture;
+    if (Options)
+    {
+        Format.Options = *Options;
+    }
+
+    return Formats.Num() - 1;
+}
+
+void FNumberTextCache::Invalidate()
+{
+    check(IsInGameThread());
+    ++TextGeneration;
+
+    if (TextGeneration == 0)
+    {
+        TextGeneration = 1;
+    }
+}
+
+uint32 FNumberTextCache::GetGeneration()
+{
+    return TextGeneration;
+}
+
+const FNumberTextCache::FFormat& FNumberTextCache::GetFormat(int32 FormatIndex)
+{
+    return GetFormats()[FormatIndex];
+}
+
+}
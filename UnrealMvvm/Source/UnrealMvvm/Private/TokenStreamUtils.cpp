@@ -4,22 +4,32 @@
 #include "Mvvm/Impl/Property/ViewModelPropertyReflection.h"
 #include "Algo/TopologicalSort.h"
 
-void UnrealMvvm_Impl::FTokenStreamUtils::EnrichWithDerivedClasses(TArray<UClass*>& Classes)
+void UnrealMvvm_Impl::FTokenStreamUtils::EnrichWithDerivedClasses(TArray<UClass*>& Classes, UClass* RootClass)
 {
+    // collect derived classes of RootClass once instead of querying them for each class in the list
     TArray<UClass*> DerivedClasses;
-    DerivedClasses.Reserve(64); // start with big enough buffer, because we will collect all derived classes here
+    DerivedClasses.Reserve(256);
+    GetDerivedClasses(RootClass, DerivedClasses, true);
 
-    // collect all derived classes in the same array
-    for (UClass* ViewModelClass : Classes)
-    {
-        GetDerivedClasses(ViewModelClass, DerivedClasses, true);
-    }
+    TSet<UClass*> ClassesSet(Classes);
 
-    // add DerivedClasses back to our Classes array
     for (UClass* DerivedClass : DerivedClasses)
     {
         // make sure we don't have duplicates here
-        Classes.AddUnique(DerivedClass);
+        if (ClassesSet.Contains(DerivedClass))
+        {
+            continue;
+        }
+
+        // add class if any of its base classes is in the list
+        for (UClass* SuperClass = DerivedClass->GetSuperClass(); SuperClass != nullptr; SuperClass = SuperClass->GetSuperClass())
+        {
+            if (ClassesSet.Contains(SuperClass))
+            {
+                Classes.Add(DerivedClass);
+                break;
+            }
+        }
     }
 }
 
@@ -55,8 +65,14 @@ FField* UnrealMvvm_Impl::FTokenStreamUtils::AddPropertiesToClass(UClass* TargetC
         Property->GetOperations().AddClassProperty(TargetClass);
     }
 
-    // Link class to populate cached data inside newly created FProperties
-    TargetClass->StaticLink();
+    // Link only new FProperties to populate their cached data. Offsets are already known.
+    // Token stream is assembled from ChildProperties list, so class itself does not need to be linked,
+    // and we don't need to link it again after temporary properties are removed
+    FArchive ArDummy;
+    for (FField* Field = TargetClass->ChildProperties; Field != FirstOriginalField; Field = Field->Next)
+    {
+        CastFieldChecked<FProperty>(Field)->LinkWithoutChangingOffset(ArDummy);
+    }
 
     return FirstOriginalField;
 }
@@ -84,8 +100,6 @@ void UnrealMvvm_Impl::FTokenStreamUtils::CleanupProperties(UClass* TargetClass,
         CurrentField = NextField;
     }
 
+    // PropertyLink and others were not changed by AddPropertiesToClass, so no need to link class again
     TargetClass->ChildProperties = FirstFieldToKeep;
-
-    // Link class to restore PropertyLink and others
-    TargetClass->StaticLink();
 }
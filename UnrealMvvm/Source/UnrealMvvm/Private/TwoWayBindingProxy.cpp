@@ -0,0 +1,12 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Mvvm/Impl/Binding/TwoWayBindingProxy.h"
+#include "UObject/Package.h"
+
+UTwoWayBindingProxy* UTwoWayBindingProxy::Create(TSharedRef<UnrealMvvm_Impl::FTwoWayBindingState> InState)
+{
+    UTwoWayBindingProxy* Proxy = NewObject<UTwoWayBindingProxy>(GetTransientPackage());
+    Proxy->Start(MoveTemp(InState));
+
+    return Proxy;
+}
@@ -1,8 +1,11 @@
 // Copyright Andrei Sudarikov. All Rights Reserved.
 
 #include "Modules/ModuleManager.h"
+#include "Mvvm/AsyncLoadBinding.h"
 #include "Mvvm/Impl/BaseView/ViewRegistry.h"
+#include "Mvvm/Impl/Binding/BindingWorker.h"
 #include "Mvvm/Impl/Property/ViewModelRegistry.h"
+#include "Mvvm/ViewModelTickManager.h"
 
 class FUnrealMvvmModuleImpl : public IModuleInterface
 {
@@ -18,6 +21,9 @@ public:
     {
         FModuleManager::Get().OnModulesChanged().RemoveAll(this);
         UnrealMvvm_Impl::FViewModelRegistry::DeleteKeptProperties();
+        FViewModelTickManager::Shutdown();
+        UnrealMvvm_Impl::FBindingWorker::CancelTextBindingsRefresh();
+        UnrealMvvm_Impl::ShutdownAsyncLoadStreamableManager();
     }
 
 private:
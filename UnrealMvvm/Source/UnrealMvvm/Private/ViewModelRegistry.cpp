@@ -3,6 +3,7 @@
 #include "Mvvm/Impl/Property/ViewModelRegistry.h"
 #include "Mvvm/BaseViewModel.h"
 #include "Mvvm/Impl/Property/TokenStreamUtils.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 namespace UnrealMvvm_Impl
 {
@@ -28,8 +29,11 @@ void FViewModelRegistry::ProcessPendingRegistrations()
         return;
     }
 
+    TRACE_CPUPROFILER_EVENT_SCOPE(FViewModelRegistry::ProcessPendingRegistrations);
+
     // Process properties and add them into lookup tables
-    TArray<UClass*> NewlyAddedViewModels;
+    // Only classes whose own properties were changed need their token streams to be regenerated
+    TArray<UClass*> ChangedViewModels;
 
     auto& UnprocessedProperties = GetUnprocessedProperties();
     if (UnprocessedProperties.Num())
@@ -38,12 +42,7 @@ void FViewModelRegistry::ProcessPendingRegistrations()
         {
             UClass* NewClass = Property.GetClass();
 
-            TArray<FViewModelPropertyReflection>* NewArray = ViewModelProperties.Find(NewClass);
-            if (!NewArray)
-            {
-                NewArray = &ViewModelProperties.Emplace(NewClass);
-                NewlyAddedViewModels.Emplace(NewClass);
-            }
+            TArray<FViewModelPropertyReflection>* NewArray = &ViewModelProperties.FindOrAdd(NewClass);
 
             // We need to check that we don't have same property already registered
             // It is possible if same ViewModel is referenced from different modules (.dll) leading to multiple instantiations of registrator template
@@ -55,30 +54,45 @@ void FViewModelRegistry::ProcessPendingRegistrations()
             if (!bPropertyAlreadyRegistered)
             {
                 NewArray->Add(Property.Reflection);
+
+                // properties of the same class usually go one after another
+                if (ChangedViewModels.Num() == 0 || ChangedViewModels.Last() != NewClass)
+                {
+                    ChangedViewModels.AddUnique(NewClass);
+                }
             }
         }
 
         UnprocessedProperties.Empty();
     }
 
-    if (NewlyAddedViewModels.Num() > 0)
+    GenerateReferenceTokenStreams(MoveTemp(ChangedViewModels));
+}
+
+void FViewModelRegistry::GenerateReferenceTokenStreams(TArray<UClass*> ViewModelClasses)
+{
+    if (ViewModelClasses.Num() == 0)
     {
-        // Add all derived classes of NewlyAddedViewModels to the list
-        // Some derived classes may have no properties, but their token streams must still be adjusted to account for tokens of base classes
-        // We need to add them manually because we won't know about them otherwise
-        FTokenStreamUtils::EnrichWithDerivedClasses(NewlyAddedViewModels);
-
-        // Sort ViewModels so base classes are located before derived ones
-        // This way we guarantee that base classes' token streams will be generated first
-        // If they are in different modules, Unreal will handle module load ordering
-        // In monolithic mode all viewmodels are processed at once, like in a single module
-        FTokenStreamUtils::SortViewModelClasses(NewlyAddedViewModels);
-
-        // Patch all new ViewModel classes, so their properties will be processed by GC
-        for (UClass* ViewModelClass : NewlyAddedViewModels)
-        {
-            GenerateReferenceTokenStream(ViewModelClass);
-        }
+        return;
+    }
+
+    TRACE_CPUPROFILER_EVENT_SCOPE(FViewModelRegistry::GenerateReferenceTokenStreams);
+
+    // Add all derived classes of ViewModelClasses to the list
+    // Some derived classes may have no properties, but their token streams must still be adjusted to account for tokens of base classes
+    // We need to add them manually because we won't know about them otherwise
+    FTokenStreamUtils::EnrichWithDerivedClasses(ViewModelClasses, UBaseViewModel::StaticClass());
+
+    // Sort ViewModels so base classes are located before derived ones
+    // This way we guarantee that base classes' token streams will be generated first
+    // If they are in different modules, Unreal will handle module load ordering
+    // In monolithic mode all viewmodels are processed at once, like in a single module
+    FTokenStreamUtils::SortViewModelClasses(ViewModelClasses);
+
+    // Patch all ViewModel classes, so their properties will be processed by GC
+    for (UClass* ViewModelClass : ViewModelClasses)
+    {
+        GenerateReferenceTokenStream(ViewModelClass);
     }
 }
 
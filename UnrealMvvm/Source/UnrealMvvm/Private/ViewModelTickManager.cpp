@@ -0,0 +1,257 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Mvvm/ViewModelTickManager.h"
+#include "Mvvm/BaseViewModel.h"
+#include "HAL/PlatformTime.h"
+
+TUniquePtr<FViewModelTickManager> FViewModelTickManager::Instance;
+
+FViewModelTickManager& FViewModelTickManager::Get()
+{
+    if (!Instance.IsValid())
+    {
+        Instance = MakeUnique<FViewModelTickManager>();
+        Instance->Groups[(int32)EViewModelTickRate::EveryFrame].Interval = 0.f;
+        Instance->Groups[(int32)EViewModelTickRate::TenHz].Interval = 0.1f;
+        Instance->Groups[(int32)EViewModelTickRate::OneHz].Interval = 1.f;
+    }
+
+    return *Instance;
+}
+
+void FViewModelTickManager::Shutdown()
+{
+    Instance.Reset();
+}
+
+FViewModelTickManager::~FViewModelTickManager()
+{
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+    }
+}
+
+void FViewModelTickManager::SetTickInterval(EViewModelTickRate TickRate, float IntervalSeconds)
+{
+    check(TickRate != EViewModelTickRate::None && TickRate < EViewModelTickRate::Num);
+    check(IntervalSeconds >= 0.f);
+
+    Groups[(int32)TickRate].Interval = IntervalSeconds;
+}
+
+float FViewModelTickManager::GetTickInterval(EViewModelTickRate TickRate) const
+{
+    check(TickRate != EViewModelTickRate::None && TickRate < EViewModelTickRate::Num);
+    return Groups[(int32)TickRate].Interval;
+}
+
+int32 FViewModelTickManager::GetNumViewModels() const
+{
+    return NumViewModels;
+}
+
+TArray<FViewModelTickManager::FClassStats> FViewModelTickManager::GetClassStats() const
+{
+    TArray<FClassStats> Result;
+
+    for (const FTickGroup& Group : Groups)
+    {
+        for (const auto& Pair : Group.Stats)
+        {
+            Result.Add(Pair.Value);
+        }
+    }
+
+    return Result;
+}
+
+void FViewModelTickManager::ResetClassStats()
+{
+    for (FTickGroup& Group : Groups)
+    {
+        for (auto It = Group.Stats.CreateIterator(); It; ++It)
+        {
+            if (It->Value.NumViewModels == 0)
+            {
+                It.RemoveCurrent();
+                continue;
+            }
+
+            It->Value.NumTicks = 0;
+            It->Value.LastTickSeconds = 0.0;
+            It->Value.TotalTickSeconds = 0.0;
+        }
+    }
+}
+
+void FViewModelTickManager::Tick(float DeltaTime)
+{
+    bTicking = true;
+
+    for (FTickGroup& Group : Groups)
+    {
+        if (Group.Buckets.Num() == 0)
+        {
+            continue;
+        }
+
+        Group.AccumulatedTime += DeltaTime;
+        if (Group.AccumulatedTime >= Group.Interval)
+        {
+            TickGroup(Group, Group.AccumulatedTime);
+            Group.AccumulatedTime = 0.f;
+        }
+    }
+
+    bTicking = false;
+
+    if (bHasRemovedWhileTicking)
+    {
+        bHasRemovedWhileTicking = false;
+
+        for (FTickGroup& Group : Groups)
+        {
+            for (FClassBucket& Bucket : Group.Buckets)
+            {
+                Bucket.ViewModels.Remove(nullptr);
+
+                for (int32 Index = 0; Index < Bucket.ViewModels.Num(); ++Index)
+                {
+                    Bucket.ViewModels[Index]->TickIndex = Index;
+                }
+            }
+
+            Group.Buckets.RemoveAll([](const FClassBucket& Bucket) { return Bucket.ViewModels.Num() == 0; });
+        }
+
+        UpdateTicker();
+    }
+}
+
+void FViewModelTickManager::TickGroup(FTickGroup& Group, float DeltaTime)
+{
+    // ViewModels added during the tick are appended and ticked next time
+    for (int32 BucketIndex = 0, NumBuckets = Group.Buckets.Num(); BucketIndex < NumBuckets; ++BucketIndex)
+    {
+        const double StartTime = FPlatformTime::Seconds();
+
+        // Buckets and their arrays may be reallocated by ViewModels added during the tick, so don't keep references
+        for (int32 Index = 0, Num = Group.Buckets[BucketIndex].ViewModels.Num(); Index < Num; ++Index)
+        {
+            if (UBaseViewModel* ViewModel = Group.Buckets[BucketIndex].ViewModels[Index])
+            {
+                ViewModel->TickViewModel(DeltaTime);
+            }
+        }
+
+        // stats may be dropped by ResetClassStats called from TickViewModel
+        if (FClassStats* Stats = Group.Stats.Find(Group.Buckets[BucketIndex].Class))
+        {
+            Stats->LastTickSeconds = FPlatformTime::Seconds() - StartTime;
+            Stats->TotalTickSeconds += Stats->LastTickSeconds;
+            Stats->NumTicks++;
+        }
+    }
+}
+
+void FViewModelTickManager::Add(UBaseViewModel* ViewModel, EViewModelTickRate TickRate)
+{
+    check(ViewModel->TickIndex == INDEX_NONE);
+
+    FTickGroup& Group = Groups[(int32)TickRate];
+    UClass* Class = ViewModel->GetClass();
+
+    FClassBucket* Bucket = Group.Buckets.FindByPredicate([&](const FClassBucket& Item) { return Item.Class == Class; });
+    if (Bucket == nullptr)
+    {
+        Bucket = &Group.Buckets.AddDefaulted_GetRef();
+        Bucket->Class = Class;
+    }
+
+    ViewModel->TickIndex = Bucket->ViewModels.Add(ViewModel);
+    NumViewModels++;
+
+    FClassStats& Stats = Group.Stats.FindOrAdd(Class);
+    Stats.Class = Class;
+    Stats.TickRate = TickRate;
+    Stats.NumViewModels++;
+
+    UpdateTicker();
+}
+
+void FViewModelTickManager::Remove(UBaseViewModel* ViewModel, EViewModelTickRate TickRate)
+{
+    const int32 Index = ViewModel->TickIndex;
+    if (Index == INDEX_NONE)
+    {
+        return;
+    }
+
+    FTickGroup& Group = Groups[(int32)TickRate];
+    UClass* Class = ViewModel->GetClass();
+
+    const int32 BucketIndex = Group.Buckets.IndexOfByPredicate([&](const FClassBucket& Item) { return Item.Class == Class; });
+    check(BucketIndex != INDEX_NONE);
+
+    FClassBucket& Bucket = Group.Buckets[BucketIndex];
+    check(Bucket.ViewModels[Index] == ViewModel);
+
+    ViewModel->TickIndex = INDEX_NONE;
+    Group.Stats.FindChecked(Class).NumViewModels--;
+    NumViewModels--;
+
+    if (bTicking)
+    {
+        Bucket.ViewModels[Index] = nullptr;
+        bHasRemovedWhileTicking = true;
+        return;
+    }
+
+    Bucket.ViewModels.RemoveAtSwap(Index);
+    if (Bucket.ViewModels.IsValidIndex(Index))
+    {
+        // last ViewModel was moved into freed slot
+        Bucket.ViewModels[Index]->TickIndex = Index;
+    }
+    else if (Bucket.ViewModels.Num() == 0)
+    {
+        Group.Buckets.RemoveAt(BucketIndex);
+    }
+
+    UpdateTicker();
+}
+
+void FViewModelTickManager::UpdateTicker()
+{
+    if (NumViewModels > 0 && !TickerHandle.IsValid())
+    {
+        TickerHandle = FTSTicker::GetCoreTicker().AddTicker(TEXT("ViewModelTickManager"), 0.f, [this](float DeltaTime)
+        {
+            Tick(DeltaTime);
+            return true;
+        });
+    }
+    else if (NumViewModels == 0 && TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+}
+
+void FViewModelTickManager::AddReferencedObjects(FReferenceCollector& Collector)
+{
+    // ViewModels are registered only while Views are listening to them, so they are referenced by Views anyway
+    for (FTickGroup& Group : Groups)
+    {
+        for (FClassBucket& Bucket : Group.Buckets)
+        {
+            Collector.AddReferencedObjects(Bucket.ViewModels);
+        }
+    }
+}
+
+FString FViewModelTickManager::GetReferencerName() const
+{
+    return TEXT("FViewModelTickManager");
+}
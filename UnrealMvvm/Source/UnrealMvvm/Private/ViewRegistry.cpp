@@ -3,6 +3,8 @@
 #include "Mvvm/Impl/BaseView/ViewRegistry.h"
 #include "Mvvm/Impl/Binding/ViewModelDynamicBinding.h"
 #include "Mvvm/Impl/Binding/BindingConfigurationBuilder.h"
+#include "Mvvm/Impl/BaseView/BaseViewComponentImpl.h"
+#include "Mvvm/Impl/Property/ViewModelRegistry.h"
 
 namespace UnrealMvvm_Impl
 {
@@ -12,8 +14,10 @@ FViewRegistry::FViewModelClassChanged FViewRegistry::ViewModelClassChanged;
 #endif
 TMap<TWeakObjectPtr<UClass>, UClass*> FViewRegistry::ViewModelClasses{};
 TMap<UClass*, FViewRegistry::FViewModelSetterPtr> FViewRegistry::ViewModelSetters{};
+TSet<UClass*> FViewRegistry::ActorViewSubsystemClasses{};
 TMap<UClass*, FViewRegistry::FBindingsCollectorPtr> FViewRegistry::BindingsCollectors{};
-TMap<TWeakObjectPtr<UClass>, FBindingConfiguration> FViewRegistry::BindingConfigurations{};
+TMap<TWeakObjectPtr<UClass>, FViewRegistry::FViewBindings> FViewRegistry::BindingConfigurations{};
+TMap<TWeakObjectPtr<UClass>, FViewRegistry::FBlueprintFunctions> FViewRegistry::BlueprintFunctions{};
 FBindingConfigurationBuilder* FViewRegistry::CurrentConfigurationBuilder = nullptr;
 
 template <typename TKey, typename TValue>
@@ -76,6 +80,11 @@ void FViewRegistry::ProcessPendingRegistrations()
                 BindingsCollectors.Add(ViewClass, Entry.BindingsCollector);
             }
 
+            if (Entry.bUsesActorViewSubsystem)
+            {
+                ActorViewSubsystemClasses.Add(ViewClass);
+            }
+
             CreateBindingConfiguration(ViewClass, ViewModelClass);
 
 #if WITH_EDITOR
@@ -101,12 +110,31 @@ FViewRegistry::FViewModelSetterPtr FViewRegistry::GetViewModelSetter(UClass* Vie
     return FindByClass(ViewModelSetters, ViewClass);
 }
 
+bool FViewRegistry::UsesActorViewSubsystem(UClass* ViewClass)
+{
+    for (UClass* Needle = ViewClass; Needle; Needle = Needle->GetSuperClass())
+    {
+        if (ActorViewSubsystemClasses.Contains(Needle))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 FViewRegistry::FBindingsCollectorPtr FViewRegistry::GetBindingsCollector(UClass* ViewClass)
 {
     return FindByClass(BindingsCollectors, ViewClass);
 }
 
 const FBindingConfiguration* FViewRegistry::GetBindingConfiguration(UClass* ViewClass)
+{
+    const FViewBindings* Found = GetViewBindings(ViewClass);
+    return Found ? &Found->Configuration : nullptr;
+}
+
+const FViewRegistry::FViewBindings* FViewRegistry::GetViewBindings(UClass* ViewClass)
 {
     // remove all entries where keys are no longer valid
     // we store BP classes there, so they may become unloaded or garbage collected
@@ -115,7 +143,24 @@ const FBindingConfiguration* FViewRegistry::GetBindingConfiguration(UClass* View
     return BindingConfigurations.Find(ViewClass);
 }
 
-uint8 FViewRegistry::RegisterViewClass(FClassGetterPtr ViewClassGetter, FClassGetterPtr ViewModelClassGetter, FViewModelSetterPtr ViewModelSetter, FBindingsCollectorPtr BindingsCollector)
+const FViewRegistry::FBlueprintFunctions& FViewRegistry::GetBlueprintFunctions(UClass* ViewClass)
+{
+    check(ViewClass);
+
+    FBlueprintFunctions* Found = BlueprintFunctions.Find(ViewClass);
+    if (Found == nullptr)
+    {
+        // new class is rare, so it's a good moment to remove entries of unloaded classes
+        ClearByKey(BlueprintFunctions);
+
+        Found = &BlueprintFunctions.Add(ViewClass);
+        ResolveBlueprintFunctions(ViewClass, *Found);
+    }
+
+    return *Found;
+}
+
+uint8 FViewRegistry::RegisterViewClass(FClassGetterPtr ViewClassGetter, FClassGetterPtr ViewModelClassGetter, FViewModelSetterPtr ViewModelSetter, FBindingsCollectorPtr BindingsCollector, bool bUsesActorViewSubsystem)
 {
     TArray<FUnprocessedViewClassEntry>& UnprocessedEntries = GetUnprocessedViewClasses();
 
@@ -124,6 +169,7 @@ uint8 FViewRegistry::RegisterViewClass(FClassGetterPtr ViewClassGetter, FClassGe
     Entry.GetViewModelClass = ViewModelClassGetter;
     Entry.ViewModelSetter = ViewModelSetter;
     Entry.BindingsCollector = BindingsCollector;
+    Entry.bUsesActorViewSubsystem = bUsesActorViewSubsystem;
 
     return 1;
 }
@@ -135,6 +181,8 @@ void FViewRegistry::RegisterViewClass(UClass* ViewClass, UClass* ViewModelClass)
 
     ViewModelClasses.Emplace(ViewClass, ViewModelClass);
 
+    // class is registered again after Blueprint recompile, so previously found functions may be gone
+    InvalidateBlueprintFunctions(ViewClass);
     CreateBindingConfiguration(ViewClass, ViewModelClass);
 
 #if WITH_EDITOR
@@ -148,6 +196,7 @@ void FViewRegistry::UnregisterViewClass(UClass* ViewClass)
     check(ViewClass);
 
     ViewModelClasses.Remove(ViewClass);
+    InvalidateBlueprintFunctions(ViewClass);
     ViewModelClassChanged.Broadcast(ViewClass, nullptr);
 }
 #endif
@@ -195,9 +244,167 @@ void FViewRegistry::CreateBindingConfiguration(UClass* ViewClass, UClass* ViewMo
         {
             Builder.AddBinding(Binding.PropertyPath);
         }
+
+        for (const FPropertyBindingEntry& Binding : ViewModelDynamicBinding->PropertyBindings)
+        {
+            Builder.AddBinding(Binding.PropertyPath);
+        }
     }
 
-    BindingConfigurations.Emplace(ViewClass, Builder.Build());
+    FViewBindings ViewBindings;
+    ViewBindings.Configuration = Builder.Build(&ViewBindings.HandlerSlots, &ViewBindings.ParentProperties);
+
+    BindingConfigurations.Emplace(ViewClass, MoveTemp(ViewBindings));
+}
+
+void FViewRegistry::ResolveBlueprintFunctions(UClass* ViewClass, FBlueprintFunctions& Functions)
+{
+    Functions.ViewModelChanged = ViewClass->FindFunctionByName(FBaseViewComponentImpl::ViewModelChangedFunctionName);
+    Functions.DynamicBinding = static_cast<UViewModelDynamicBinding*>(UBlueprintGeneratedClass::GetDynamicBindingObject(ViewClass, UViewModelDynamicBinding::StaticClass()));
+
+    if (Functions.DynamicBinding != nullptr)
+    {
+        Functions.BindingHandlers.Reserve(Functions.DynamicBinding->BlueprintBindings.Num());
+
+        for (const FBlueprintBindingEntry& Binding : Functions.DynamicBinding->BlueprintBindings)
+        {
+            UFunction* Handler = ViewClass->FindFunctionByName(Binding.FunctionName);
+            Functions.BindingHandlers.Add(Handler);
+
+            // all bindings of a dispatch event share the same batch event
+            if (Handler != nullptr && !Binding.BatchFunctionName.IsNone() && !Functions.DispatchBatchHandlers.Contains(Handler))
+            {
+                if (UFunction* BatchHandler = ViewClass->FindFunctionByName(Binding.BatchFunctionName))
+                {
+                    Functions.DispatchBatchHandlers.Add(Handler, BatchHandler);
+                }
+            }
+        }
+
+        Functions.PropertyBindings.Reserve(Functions.DynamicBinding->PropertyBindings.Num());
+
+        for (const FPropertyBindingEntry& Binding : Functions.DynamicBinding->PropertyBindings)
+        {
+            TSharedRef<FPropertyBinding> Resolved = MakeShared<FPropertyBinding>();
+            ResolvePropertyBinding(ViewClass, Binding, *Resolved);
+            Functions.PropertyBindings.Add(Resolved);
+        }
+    }
+}
+
+void FViewRegistry::ResolvePropertyBinding(UClass* ViewClass, const FPropertyBindingEntry& Entry, FPropertyBinding& OutBinding)
+{
+    OutBinding.Conversion = Entry.Conversion;
+
+    // find ViewModel property at the end of the path
+    const FViewModelPropertyReflection* Source = nullptr;
+    UClass* OwnerClass = GetViewModelClass(ViewClass);
+
+    for (const FName& PropertyName : Entry.PropertyPath)
+    {
+        Source = OwnerClass ? FViewModelRegistry::FindProperty(OwnerClass, PropertyName) : nullptr;
+        if (Source == nullptr)
+        {
+            return;
+        }
+
+        OwnerClass = Source->GetOperations().GetValueClass();
+    }
+
+    // find target property, it may be located inside an object referenced by View
+    TArray<FProperty*> TargetPath;
+    UStruct* OwnerStruct = ViewClass;
+
+    for (int32 Index = 0; Index < Entry.TargetPath.Num(); ++Index)
+    {
+        FProperty* Property = OwnerStruct ? FindFProperty<FProperty>(OwnerStruct, Entry.TargetPath[Index]) : nullptr;
+        if (Property == nullptr)
+        {
+            return;
+        }
+
+        if (Index < Entry.TargetPath.Num() - 1)
+        {
+            FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property);
+            OwnerStruct = ObjectProperty ? ObjectProperty->PropertyClass : nullptr;
+        }
+
+        TargetPath.Add(Property);
+    }
+
+    if (Source == nullptr || TargetPath.Num() == 0)
+    {
+        return;
+    }
+
+    // types were checked by editor, but ViewModel or View may have changed since then
+    FProperty* Target = TargetPath.Last();
+    bool bCompatible = false;
+
+    // converted values are read into a small buffer of source type, so it must match exactly what conversion expects
+    const FViewModelPropertyOperations& SourceOps = Source->GetOperations();
+
+    switch (Entry.Conversion)
+    {
+    case EPropertyBindingConversion::None:
+        bCompatible = SourceOps.IsSameType(Target);
+        break;
+
+    case EPropertyBindingConversion::FromBool:
+        bCompatible = SourceOps.IsPrimitiveType(EPrimitiveValueType::Bool) && Target->IsA<FBoolProperty>();
+        break;
+
+    case EPropertyBindingConversion::FromByte:
+        bCompatible = SourceOps.IsPrimitiveType(EPrimitiveValueType::Byte) && Target->IsA<FNumericProperty>();
+        break;
+
+    case EPropertyBindingConversion::FromInt:
+        bCompatible = SourceOps.IsPrimitiveType(EPrimitiveValueType::Int) && Target->IsA<FNumericProperty>();
+        break;
+
+    case EPropertyBindingConversion::FromInt64:
+        bCompatible = SourceOps.IsPrimitiveType(EPrimitiveValueType::Int64) && Target->IsA<FNumericProperty>();
+        break;
+
+    case EPropertyBindingConversion::FromFloat:
+        bCompatible = SourceOps.IsPrimitiveType(EPrimitiveValueType::Float) && Target->IsA<FNumericProperty>();
+        break;
+
+    case EPropertyBindingConversion::FromDouble:
+        bCompatible = SourceOps.IsPrimitiveType(EPrimitiveValueType::Double) && Target->IsA<FNumericProperty>();
+        break;
+
+    case EPropertyBindingConversion::BoolToVisibility:
+        bCompatible = SourceOps.IsPrimitiveType(EPrimitiveValueType::Bool) && FDirectPropertyChangeHandler::IsVisibilityProperty(Target);
+        break;
+
+    case EPropertyBindingConversion::FloatToPercentText:
+        bCompatible = SourceOps.IsPrimitiveType(EPrimitiveValueType::Float) && Target->IsA<FTextProperty>();
+        break;
+
+    case EPropertyBindingConversion::DoubleToPercentText:
+        bCompatible = SourceOps.IsPrimitiveType(EPrimitiveValueType::Double) && Target->IsA<FTextProperty>();
+        break;
+    }
+
+    if (bCompatible)
+    {
+        OutBinding.Source = Source;
+        OutBinding.TargetPath = MoveTemp(TargetPath);
+    }
+}
+
+void FViewRegistry::InvalidateBlueprintFunctions(UClass* ViewClass)
+{
+    // derived classes may use functions from this one, so they are invalidated too
+    for (auto It = BlueprintFunctions.CreateIterator(); It; ++It)
+    {
+        UClass* Class = It.Key().Get();
+        if (Class == nullptr || ViewClass == nullptr || Class->IsChildOf(ViewClass))
+        {
+            It.RemoveCurrent();
+        }
+    }
 }
 
 TArray<FViewRegistry::FUnprocessedViewClassEntry>& FViewRegistry::GetUnprocessedViewClasses()
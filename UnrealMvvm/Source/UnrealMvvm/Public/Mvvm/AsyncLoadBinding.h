@@ -0,0 +1,128 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Mvvm/Impl/Binding/BindImpl.h"
+#include "Engine/StreamableManager.h"
+#include "UObject/SoftObjectPtr.h"
+
+namespace UnrealMvvm_Impl
+{
+    /*
+     * Returns Streamable Manager used by BindAsyncLoad. It is the one of Asset Manager when it is initialized,
+     * otherwise (e.g. in commandlets or programs without Asset Manager) it is owned by UnrealMvvm module
+     */
+    UNREALMVVM_API FStreamableManager& GetAsyncLoadStreamableManager();
+
+    /* Destroys Streamable Manager owned by module. Called when module is shut down */
+    void ShutdownAsyncLoadStreamableManager();
+
+    template <typename T>
+    struct TSoftObjectPtrTraits
+    {
+        static constexpr bool IsSoftObjectPtr = false;
+    };
+
+    template <typename T>
+    struct TSoftObjectPtrTraits<TSoftObjectPtr<T>>
+    {
+        static constexpr bool IsSoftObjectPtr = true;
+        using FObjectType = T;
+    };
+
+    // loads soft object asynchronously and invokes callback once it is resident, newer value supersedes pending load
+    template <typename TObject, typename TCallback>
+    struct TAsyncLoadCallback
+    {
+        TAsyncLoadCallback(TCallback&& InCallback, TAsyncLoadPriority InPriority)
+            : State(MakeShared<FState>(MoveTemp(InCallback)))
+            , Priority(InPriority)
+        {
+        }
+
+        void operator()(const TSoftObjectPtr<TObject>& Value) const
+        {
+            State->ReleaseHandle();
+
+            if (Value.IsNull())
+            {
+                State->Callback(nullptr);
+                return;
+            }
+
+            if (TObject* Object = Value.Get())
+            {
+                State->Callback(Object);
+                return;
+            }
+
+            TWeakPtr<FState> WeakState = State;
+            State->Handle = GetAsyncLoadStreamableManager().RequestAsyncLoad(Value.ToSoftObjectPath(), FStreamableDelegate::CreateLambda([WeakState, Value]
+            {
+                // state is gone if View was destroyed in the meantime
+                if (TSharedPtr<FState> PinnedState = WeakState.Pin())
+                {
+                    PinnedState->Callback(Value.Get());
+                }
+            }), Priority);
+        }
+
+        struct FState
+        {
+            explicit FState(TCallback&& InCallback)
+                : Callback(MoveTemp(InCallback))
+            {
+            }
+
+            ~FState()
+            {
+                ReleaseHandle();
+            }
+
+            // cancels pending load or releases loaded object
+            void ReleaseHandle()
+            {
+                if (Handle.IsValid())
+                {
+                    if (Handle->IsLoadingInProgress())
+                    {
+                        Handle->CancelHandle();
+                    }
+                    else
+                    {
+                        Handle->ReleaseHandle();
+                    }
+
+                    Handle.Reset();
+                }
+            }
+
+            TCallback Callback;
+
+            // kept after load completes, so object stays resident while it is displayed
+            TSharedPtr<FStreamableHandle> Handle;
+        };
+
+        // shared between copies of this callback, pending loads reference it weakly
+        TSharedRef<FState> State;
+        TAsyncLoadPriority Priority;
+    };
+}
+
+/*
+ * Binds TSoftObjectPtr property to a lambda that receives loaded object: void (ObjectType* Object).
+ * Object is loaded asynchronously via Streamable Manager, so handler never calls LoadSynchronous. Object that is already resident is passed immediately.
+ * Lambda receives nullptr if value is null or object failed to load.
+ * New value arriving before previous load is finished cancels previous load. Loaded object is kept resident until value changes or View is destroyed.
+ *
+ * Pass the same Priority to all bindings of a screen to make its assets stream together
+ */
+template<typename TOwner, typename TProperty, typename TCallback>
+typename TEnableIf< UnrealMvvm_Impl::TSoftObjectPtrTraits<UnrealMvvm_Impl::TPropertyValueType_T<TProperty>>::IsSoftObjectPtr >::Type
+BindAsyncLoad(TOwner* ThisPtr, TProperty Property, TCallback&& Callback, TAsyncLoadPriority Priority = FStreamableManager::DefaultAsyncLoadPriority)
+{
+    using FObjectType = typename UnrealMvvm_Impl::TSoftObjectPtrTraits<UnrealMvvm_Impl::TPropertyValueType_T<TProperty>>::FObjectType;
+    using FAsyncCallback = UnrealMvvm_Impl::TAsyncLoadCallback<FObjectType, std::decay_t<TCallback>>;
+
+    __BindImpl(ThisPtr, Property, FAsyncCallback(std::decay_t<TCallback>(Forward<TCallback>(Callback)), Priority));
+}
@@ -0,0 +1,119 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Async/Async.h"
+#include "Async/Future.h"
+#include "Mvvm/BaseViewModel.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+/*
+ * Feeds ViewModel property of type TOptional<TValue> from a TFuture, e.g. result of expensive query running on another thread.
+ * Property is reset to unset value (pending) when request starts and is set only once, on game thread, when Future resolves.
+ * Views see pending state as property without value, so handlers never wait for the result.
+ *
+ * Result of cancelled request is dropped, Future itself keeps running. Cancel requests when no View is listening anymore:
+ *
+ *   // header
+ *   VM_PROP_AG_AS(TOptional<float>, Eta, public, private);
+ *   TAsyncViewModelValue<UMyViewModel, float> EtaRequest{ EtaProperty() };
+ *
+ *   void SubscriptionStatusChanged(bool bHasConnectedViews) override
+ *   {
+ *       if (!bHasConnectedViews) { EtaRequest.Cancel(); }
+ *   }
+ *
+ *   // cpp
+ *   EtaRequest.Start(this, Async(EAsyncExecution::ThreadPool, [Path] { return ComputeEta(Path); }));
+ */
+template <typename TOwner, typename TValue>
+class TAsyncViewModelValue
+{
+    static_assert(TIsDerivedFrom<TOwner, UBaseViewModel>::Value, "TOwner must be derived from UBaseViewModel");
+
+public:
+    using FProperty = TViewModelProperty<TOwner, TOptional<TValue>>;
+
+    UE_NONCOPYABLE(TAsyncViewModelValue);
+
+    explicit TAsyncViewModelValue(const FProperty* InProperty)
+        : Property(InProperty)
+    {
+        check(Property->HasSetter());
+    }
+
+    ~TAsyncViewModelValue()
+    {
+        Cancel();
+    }
+
+    /* Cancels previous request, resets property to pending state and waits for Future to resolve */
+    void Start(TOwner* Owner, TFuture<TValue>&& Future)
+    {
+        check(IsInGameThread());
+        check(Owner);
+        check(Future.IsValid());
+
+        Cancel();
+        Property->SetValue(Owner, TOptional<TValue>());
+
+        FRequestRef NewRequest = MakeShared<FRequest, ESPMode::ThreadSafe>();
+        Request = NewRequest;
+
+        Future.Then([NewRequest, WeakOwner = TWeakObjectPtr<TOwner>(Owner), Property = Property](TFuture<TValue>&& Ready)
+        {
+            if (IsInGameThread())
+            {
+                // Future was already resolved or resolved on game thread
+                Resolve(NewRequest, WeakOwner.Get(), Property, Ready.Consume());
+                return;
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [NewRequest, WeakOwner, Property, Value = Ready.Consume()]() mutable
+            {
+                Resolve(NewRequest, WeakOwner.Get(), Property, MoveTemp(Value));
+            });
+        });
+    }
+
+    /* Drops result of pending request. Property keeps its current value */
+    void Cancel()
+    {
+        if (Request.IsValid())
+        {
+            Request->bCancelled = true;
+            Request.Reset();
+        }
+    }
+
+    /* Returns whether request was started and not yet resolved or cancelled */
+    bool IsPending() const
+    {
+        return Request.IsValid() && !Request->bResolved;
+    }
+
+private:
+    // accessed only on game thread, shared with continuation to know whether its result is still needed
+    struct FRequest
+    {
+        bool bCancelled = false;
+        bool bResolved = false;
+    };
+
+    using FRequestRef = TSharedRef<FRequest, ESPMode::ThreadSafe>;
+
+    static void Resolve(const FRequestRef& InRequest, TOwner* Owner, const FProperty* InProperty, TValue&& Value)
+    {
+        if (InRequest->bCancelled || Owner == nullptr)
+        {
+            return;
+        }
+
+        InRequest->bResolved = true;
+        InProperty->SetValue(Owner, TOptional<TValue>(MoveTemp(Value)));
+    }
+
+    const FProperty* Property;
+    TSharedPtr<FRequest, ESPMode::ThreadSafe> Request;
+};
@@ -0,0 +1,141 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Mvvm/ViewModelProperty.h"
+#include "Mvvm/ViewModelPropertyTypeTraits.h"
+#include "Mvvm/Impl/Binding/ViewModelSubscribers.h"
+#include "Mvvm/Impl/Property/CanCompareHelper.h"
+#include "Mvvm/Impl/Property/PropertyTypeSelector.h"
+#include "Mvvm/Impl/Property/ViewModelPropertyMacros.h"
+#include "Templates/UniquePtr.h"
+
+#ifndef UE_REQUIRES
+#define UE_REQUIRES , TEMPLATE_REQUIRES
+#endif
+
+/*
+ * Base class for lightweight ViewModels that are not UObjects.
+ * Useful for huge collections (leaderboards, loot tables, etc) where allocating and collecting UObject per item is too expensive.
+ *
+ * Properties are declared using the same VM_PROP_* macros, but they are not registered in FViewModelRegistry,
+ * so they are not visible to Blueprints and Garbage Collector. Use TStrongObjectPtr to keep UObjects referenced from such ViewModel alive.
+ * Lifetime is explicit: owner keeps instances in TUniquePtr, TSharedPtr, etc. ViewModel must outlive all Views bound to it.
+ *
+ * Bind to these ViewModels using TStructViewModelBinding.
+ *
+ * Example:
+ *   // header
+ *   class FMyRowViewModel : public FBaseStructViewModel
+ *   {
+ *       VM_STRUCT_BODY(FMyRowViewModel);
+ *
+ *       VM_PROP_AG_AS(FText, Name, public);
+ *   };
+ *
+ *   // cpp
+ *   VM_STRUCT_PROP_IMPL(FMyRowViewModel, Name);
+ */
+class UNREALMVVM_API FBaseStructViewModel
+{
+public:
+    using FSubscribers = UnrealMvvm_Impl::TViewModelSubscribers<FBaseStructViewModel>;
+    using FSubscriptionHandle = UnrealMvvm_Impl::FViewModelSubscriptionHandle;
+    using FSubscriberCallbackPtr = FSubscribers::FCallbackPtr;
+
+    UE_NONCOPYABLE(FBaseStructViewModel);
+
+    FBaseStructViewModel() = default;
+    virtual ~FBaseStructViewModel();
+
+    /*
+     * Subscribes to changes of this ViewModel.
+     * Callback receives Owner pointer as first argument. Returned handle allows to unsubscribe in O(1)
+     */
+    FSubscriptionHandle Subscribe(void* Owner, FSubscriberCallbackPtr Callback)
+    {
+        FSubscribers& State = GetOrCreateSubscribers();
+
+        if (State.Num() == 0)
+        {
+            SubscriptionStatusChanged(true);
+        }
+
+        return State.Add(Owner, Callback);
+    }
+
+    /* Unsubscribes from changes of this ViewModel by SubscriptionHandle */
+    void Unsubscribe(FSubscriptionHandle Handle)
+    {
+        check(Subscribers.IsValid());
+
+        if (Subscribers->Remove(Handle) && Subscribers->Num() == 0)
+        {
+            SubscriptionStatusChanged(false);
+        }
+    }
+
+protected:
+    /* Call this method to notify any connected View that given property was changed */
+    void RaiseChanged(const FViewModelPropertyBase* Property)
+    {
+        checkf(Property, TEXT("You should not call RaiseChanged with nullptr property"));
+
+        if (Subscribers.IsValid())
+        {
+            Subscribers->Broadcast(this, Property);
+        }
+    }
+
+    /* Call this method to notify any connected View that given properties were changed */
+    template <typename... TProperty UE_REQUIRES(sizeof...(TProperty) >= 2)>
+    void RaiseChanged(const TProperty*... Props)
+    {
+        (RaiseChanged(Props), ...);
+    }
+
+    /* Called when first subscription added or last subscription removed */
+    virtual void SubscriptionStatusChanged(bool bHasConnectedViews) {}
+
+    /* Returns whether this ViewModel has any Views listening to its changes */
+    bool HasConnectedViews() const { return Subscribers.IsValid() && Subscribers->Num() > 0; }
+
+    /*
+     * Sets new value to provided variable.
+     * Optionaly performs comparison of current value and new value.
+     * Returns true if value was changed
+     */
+    template <typename TValue>
+    bool TrySetValue(TValue& Field, typename UnrealMvvm_Impl::TPropertyTypeSelector<TValue>::SetterType InValue)
+    {
+        return UnrealMvvm_Impl::TrySetValue<TValue>(Field, InValue);
+    }
+
+private:
+    FSubscribers& GetOrCreateSubscribers();
+
+    // created on first subscription, never released until ViewModel is destroyed, because it may be in the middle of broadcast
+    TUniquePtr<FSubscribers> Subscribers;
+};
+
+/*
+ * Declares types required by VM_PROP_* macros. Place it at the beginning of class derived from FBaseStructViewModel
+ */
+#define VM_STRUCT_BODY(ClassName) \
+public: \
+    using ThisClass = ClassName; \
+private:
+
+/*
+ * Defines property of struct ViewModel declared with VM_PROP_* macro that has a Setter. Place it in cpp file.
+ * Getter and Setter visibility are taken from property declaration.
+ * Field offset is only used by UObject ViewModels to report references to GC, so it is always 0 here
+ */
+#define VM_STRUCT_PROP_IMPL(ClassName, Name) \
+    ClassName::F##Name##Property ClassName::Name##PropertyValue = { &ClassName::Get##Name, &ClassName::Set##Name, 0, ClassName::Name##PropertyGetterVisibility, ClassName::Name##PropertySetterVisibility }
+
+/*
+ * Defines property of struct ViewModel declared with VM_PROP_MG_NF macro. Place it in cpp file
+ */
+#define VM_STRUCT_PROP_IMPL_MG_NF(ClassName, Name) \
+    ClassName::F##Name##Property ClassName::Name##PropertyValue = { &ClassName::Get##Name, nullptr, 0, ClassName::Name##PropertyGetterVisibility, ClassName::Name##PropertySetterVisibility }
@@ -42,6 +42,24 @@ protected:
     /* Override this method to get notified about ViewModel changes. OldViewModel and NewViewModel may be nullptr */
     virtual void OnViewModelChanged(TViewModel* OldViewModel, TViewModel* NewViewModel) {}
 
+    /*
+     * Enables diff-based rebind. When enabled, replacing ViewModel of a constructed View invokes only bindings whose values differ between old and new ViewModels.
+     * Useful for Views that are reused with many ViewModels, e.g. entries of ListView
+     */
+    void SetDiffRebindEnabled(bool bEnabled)
+    {
+        UnrealMvvm_Impl::TBaseViewImpl<TOwner, TViewModel>::GetBindingWorker(this).SetDiffRebindEnabled(bEnabled);
+    }
+
+    /*
+     * Enables diff-based propagation. When enabled, replacing ViewModel in the middle of Property Path invokes only bindings whose values differ between old and new ViewModels.
+     * Useful for Views that display "selected" child ViewModel
+     */
+    void SetDiffPropagationEnabled(bool bEnabled)
+    {
+        UnrealMvvm_Impl::TBaseViewImpl<TOwner, TViewModel>::GetBindingWorker(this).SetDiffPropagationEnabled(bEnabled);
+    }
+
     /* Creates Property Path for passing into Bind function */
     template
     <
@@ -59,6 +77,9 @@ private:
     template<typename T, typename P, typename C>
     friend void __BindImpl(T*, P, C&&);
 
+    template<typename T, typename PV, typename V, typename W, typename S, typename E>
+    friend void BindTwoWay(T*, const TViewModelProperty<PV, V>*, W, S, E);
+
     template<typename O, typename V, typename U>
     friend class UnrealMvvm_Impl::TBaseViewImplWithComponent;
 
@@ -93,9 +114,10 @@ private:
         }
     }
 
-    UObject* CachedComponent = nullptr;
+    /* Component, Extension or FActorViewEntry selected by TBaseViewImpl. Only accessed through TBaseViewImplWithComponent::GetExtension */
+    void* CachedComponent = nullptr;
     static uint8 Registered;
 };
 
 template<typename TOwner, typename TViewModel>
-uint8 TBaseView<TOwner, TViewModel>::Registered = UnrealMvvm_Impl::FViewRegistry::RegisterViewClass(&TOwner::StaticClass, &TViewModel::StaticClass, &TBaseView<TOwner, TViewModel>::SetViewModelStatic, &TBaseView<TOwner, TViewModel>::CollectNativeBindings);
+uint8 TBaseView<TOwner, TViewModel>::Registered = UnrealMvvm_Impl::FViewRegistry::RegisterViewClass(&TOwner::StaticClass, &TViewModel::StaticClass, &TBaseView<TOwner, TViewModel>::SetViewModelStatic, &TBaseView<TOwner, TViewModel>::CollectNativeBindings, UnrealMvvm_Impl::TActorViewStorage<TOwner>::Value == EActorViewStorage::Subsystem);
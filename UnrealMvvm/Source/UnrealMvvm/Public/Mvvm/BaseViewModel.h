@@ -5,15 +5,20 @@
 #include "UObject/Object.h"
 #include "Mvvm/ViewModelProperty.h"
 #include "Mvvm/ViewModelPropertyTypeTraits.h"
+#include "Mvvm/ViewModelTickRate.h"
+#include "Mvvm/Impl/Binding/ViewModelSubscribers.h"
 #include "Mvvm/Impl/Property/CanCompareHelper.h"
 #include "Mvvm/Impl/Property/PropertyTypeSelector.h"
 #include "Mvvm/Impl/Property/ViewModelPropertyMacros.h"
+#include "Templates/UniquePtr.h"
 #include "BaseViewModel.generated.h"
 
 #ifndef UE_REQUIRES
 #define UE_REQUIRES , TEMPLATE_REQUIRES
 #endif
 
+class FViewModelTickManager;
+
 /*
  * Base class for ViewModels
  */ 
@@ -25,47 +30,80 @@ class UNREALMVVM_API UBaseViewModel : public UObject
 public:
     DECLARE_MULTICAST_DELEGATE_OneParam(FPropertyChangedDelegate, const FViewModelPropertyBase*);
 
-    /* Subscribes to changes of this ViewModel */
-    FDelegateHandle Subscribe(FPropertyChangedDelegate::FDelegate&& Callback)
+    using FSubscriptionHandle = UnrealMvvm_Impl::FViewModelSubscriptionHandle;
+    using FSubscriberCallbackPtr = UnrealMvvm_Impl::FViewModelSubscribers::FCallbackPtr;
+
+    /*
+     * Subscribes to changes of this ViewModel without allocating a delegate.
+     * Callback receives Owner pointer as first argument. Returned handle allows to unsubscribe in O(1)
+     */
+    FSubscriptionHandle Subscribe(void* Owner, FSubscriberCallbackPtr Callback)
     {
-        if (!Changed.IsBound())
+        FSubscriptionState& State = GetOrCreateSubscriptionState();
+
+        if (State.Subscribers.Num() == 0)
         {
-            SubscriptionStatusChanged(true);
+            NotifySubscriptionStatusChanged(true);
         }
 
-        return Changed.Add(Callback);
+        return State.Subscribers.Add(Owner, Callback);
     }
 
-    /* Unsubscribes from changes of this ViewModel by DelegateHandle */
-    void Unsubscribe(FDelegateHandle Handle)
+    /* Unsubscribes from changes of this ViewModel by SubscriptionHandle */
+    void Unsubscribe(FSubscriptionHandle Handle)
     {
-        const bool bWasBound = Changed.IsBound();
-        Changed.Remove(Handle);
+        check(SubscriptionState.IsValid());
 
-        if (bWasBound && !Changed.IsBound())
+        // handle may be stale if subscriber was already removed by Unsubscribe(Object)
+        if (SubscriptionState->Subscribers.Remove(Handle) && SubscriptionState->Subscribers.Num() == 0)
         {
-            SubscriptionStatusChanged(false);
+            NotifySubscriptionStatusChanged(false);
         }
     }
 
+    /* Subscribes to changes of this ViewModel */
+    FDelegateHandle Subscribe(FPropertyChangedDelegate::FDelegate&& Callback);
+
+    /* Unsubscribes from changes of this ViewModel by DelegateHandle */
+    void Unsubscribe(FDelegateHandle Handle);
+
     /* Unsubscribes given Object from changes of this ViewModel */
-    void Unsubscribe(const void* InUserObject)
-    {
-        const bool bWasBound = Changed.IsBound();
-        Changed.RemoveAll(InUserObject);
+    void Unsubscribe(const void* InUserObject);
 
-        if (bWasBound && !Changed.IsBound())
-        {
-            SubscriptionStatusChanged(false);
-        }
-    }
+    /*
+     * Puts this ViewModel and all objects reachable from its properties into a GC cluster with this ViewModel as root.
+     * Garbage Collector processes clustered objects as a single unit, which speeds up reachability analysis of large ViewModel trees.
+     * GC does not rescan references of clustered objects, so cluster is dissolved as soon as any clustered ViewModel raises change of a property that holds object references.
+     *
+     * Contract: object references of clustered ViewModels are changed only through ViewModel property setters that raise change.
+     * Containers of object references must be replaced with a new value, never mutated in place.
+     * ViewModels with object references outside of ViewModel properties (e.g. plain UPROPERTY) are rejected, no cluster is created for them.
+     * The same applies to non-ViewModel objects reachable from ViewModel properties: cluster is not created if any of them holds object references.
+     * Returns whether cluster was created
+     */
+    bool CreateViewModelCluster();
+
+    /* Dissolves GC cluster this ViewModel belongs to */
+    void DissolveViewModelCluster();
+
+    /* Returns whether this ViewModel belongs to a GC cluster created by CreateViewModelCluster. Returns false after GC dissolved the cluster */
+    bool IsInViewModelCluster() const;
 
 protected:
     /* Call this method to notify any connected View that given property was changed */
     void RaiseChanged(const FViewModelPropertyBase* Property)
     {
         checkf(Property, TEXT("You should not call RaiseChanged with nullptr property"));
-        Changed.Broadcast(Property);
+
+        if (bInCluster)
+        {
+            DissolveClusterIfReferencesChanged(Property);
+        }
+
+        if (SubscriptionState.IsValid())
+        {
+            SubscriptionState->Subscribers.Broadcast(this, Property);
+        }
     }
 
     /* Call this method to notify any connected View that given properties were changed */
@@ -85,7 +123,19 @@ protected:
     virtual void SubscriptionStatusChanged(bool bHasConnectedViews) {}
 
     /* Returns whether this ViewModel has any Views listening to its changes */
-    bool HasConnectedViews() const { return Changed.IsBound(); }
+    bool HasConnectedViews() const { return SubscriptionState.IsValid() && SubscriptionState->Subscribers.Num() > 0; }
+
+    /*
+     * Makes FViewModelTickManager call TickViewModel with given rate while this ViewModel has connected Views.
+     * Pass EViewModelTickRate::None to stop ticking
+     */
+    void SetTickRate(EViewModelTickRate InTickRate);
+
+    /* Returns rate passed into SetTickRate */
+    EViewModelTickRate GetTickRate() const { return TickRate; }
+
+    /* Called by FViewModelTickManager, see SetTickRate. Use it to poll game state that has no change notifications */
+    virtual void TickViewModel(float DeltaTime) {}
 
     /*
      * Sets new value to provided variable.
@@ -95,39 +145,47 @@ protected:
     template <typename TValue>
     bool TrySetValue(TValue& Field, typename UnrealMvvm_Impl::TPropertyTypeSelector<TValue>::SetterType InValue)
     {
-        // check if we need to compare values
-        if constexpr (TViewModelPropertyTypeTraits<TValue>::WithSetterComparison && UnrealMvvm_Impl::TCanCompareHelper<TValue>::Value)
-        {
-            // check if we need to compare structs using Identical
-            if constexpr (TStructOpsTypeTraits<TValue>::WithIdentical)
-            {
-                // use Identical method
-                if (!Field.Identical(&InValue, 0))
-                {
-                    Field = InValue;
-                    return true;
-                }
-                return false;
-            }
-            else
-            {
-                // use operator ==
-                if (!(Field == InValue))
-                {
-                    Field = InValue;
-                    return true;
-                }
-                return false;
-            }
-        }
-        else
+        return UnrealMvvm_Impl::TrySetValue<TValue>(Field, InValue);
+    }
+
+private:
+    /*
+     * Subscription state. Created on first subscription, so ViewModels never observed by any View pay only for a pointer.
+     * Delegate based subscribers are notified via single intrusive subscriber
+     */
+    struct FSubscriptionState
+    {
+        UnrealMvvm_Impl::FViewModelSubscribers Subscribers;
+        FPropertyChangedDelegate Delegate;
+        FSubscriptionHandle DelegateHandle;
+    };
+
+    friend class FViewModelTickManager;
+
+    FSubscriptionState& GetOrCreateSubscriptionState();
+
+    void NotifySubscriptionStatusChanged(bool bHasConnectedViews)
+    {
+        if (TickRate != EViewModelTickRate::None)
         {
-            // no comparison needed, just set the value
-            Field = InValue;
-            return true;
+            UpdateTickRegistration(bHasConnectedViews);
         }
+
+        SubscriptionStatusChanged(bHasConnectedViews);
     }
 
-private:
-    FPropertyChangedDelegate Changed;
+    void UpdateTickRegistration(bool bHasConnectedViews);
+    static void BroadcastDelegate(void* Owner, UBaseViewModel* ViewModel, const FViewModelPropertyBase* Property);
+    void RemoveDelegateSubscriberIfUnbound();
+    void DissolveClusterIfReferencesChanged(const FViewModelPropertyBase* Property);
+
+    TUniquePtr<FSubscriptionState> SubscriptionState;
+
+    // set on all ViewModels inside cluster created by CreateViewModelCluster. May stay set after GC dissolved the cluster, see IsInViewModelCluster
+    bool bInCluster = false;
+
+    EViewModelTickRate TickRate = EViewModelTickRate::None;
+
+    // index inside bucket of FViewModelTickManager while ViewModel is ticked
+    int32 TickIndex = INDEX_NONE;
 };
@@ -0,0 +1,96 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "GameFramework/Actor.h"
+#include "Templates/UniquePtr.h"
+#include "UObject/ObjectKey.h"
+#include "Mvvm/Impl/Binding/BindingWorker.h"
+#include "Mvvm/Impl/BaseView/BaseViewComponentImpl.h"
+#include "ActorViewSubsystem.generated.h"
+
+/*
+ * Where Actor View keeps its ViewModel and bindings.
+ * Native Actor View selects storage by declaring: static constexpr EActorViewStorage ViewStorage = EActorViewStorage::Subsystem;
+ */
+enum class EActorViewStorage : uint8
+{
+    Component,  // UBaseViewComponent is created and registered on Actor
+    Subsystem,  // FActorViewEntry is stored in UActorViewSubsystem. View must call UActorViewSubsystem::ViewBeginPlay / ViewEndPlay
+};
+
+/* ViewModel and bindings of an Actor View stored in UActorViewSubsystem instead of UBaseViewComponent */
+class UNREALMVVM_API FActorViewEntry : public UnrealMvvm_Impl::TBaseViewComponentImpl<FActorViewEntry>
+{
+public:
+    explicit FActorViewEntry(AActor* InActor)
+        : Actor(InActor)
+    {
+    }
+
+    bool IsConstructed() const { return bConstructed; }
+    UObject* GetViewObject() const { return Actor; }
+
+private:
+    template<typename U, typename V>
+    friend class TBaseView;
+    friend class UMvvmStatics;
+    friend class UActorViewSubsystem;
+    template <typename TView>
+    friend class UnrealMvvm_Impl::TBaseViewComponentImpl;
+    template<typename O, typename V, typename U>
+    friend class UnrealMvvm_Impl::TBaseViewImplWithComponent;
+
+    /* Returns Entry of a given actor. Creates new instance if not found. Returns nullptr if Actor has no UActorViewSubsystem */
+    static FActorViewEntry* Request(AActor* Actor);
+
+    /* Returns existing Entry or nullptr if not found */
+    static FActorViewEntry* Get(const AActor* Actor);
+
+    void BeginPlay();
+    void EndPlay();
+
+    AActor* Actor;
+
+    /* Referenced by UActorViewSubsystem */
+    TObjectPtr<UBaseViewModel> ViewModel;
+
+    UnrealMvvm_Impl::FBindingWorker BindingWorker;
+
+    /* Set between ViewBeginPlay and ViewEndPlay. HasActorBegunPlay is still false during BeginPlay */
+    bool bConstructed = false;
+};
+
+/*
+ * Side table of Actor Views that use EActorViewStorage::Subsystem.
+ * Spawning such View does not create and register a component. Entries are dropped after their Actors are garbage collected
+ */
+UCLASS()
+class UNREALMVVM_API UActorViewSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /* Starts listening to ViewModel. Must be called from BeginPlay of Actor View */
+    static void ViewBeginPlay(AActor* Actor);
+
+    /* Stops listening to ViewModel. Must be called from EndPlay of Actor View */
+    static void ViewEndPlay(AActor* Actor);
+
+    /* Returns number of Views stored in this subsystem */
+    int32 GetNumViews() const { return Entries.Num(); }
+
+    void Initialize(FSubsystemCollectionBase& Collection) override;
+    void Deinitialize() override;
+
+    static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
+private:
+    friend class FActorViewEntry;
+
+    void RemoveStaleEntries();
+
+    TMap<TObjectKey<AActor>, TUniquePtr<FActorViewEntry>> Entries;
+    FDelegateHandle PostGarbageCollectHandle;
+};
@@ -15,20 +15,96 @@ class UBaseViewModel;
 namespace UnrealMvvm_Impl
 {
 
+    /*
+     * Collects dispatch indices of Blueprint bindings invoked while View is being initialized.
+     * When scope ends, each dispatch event is called once through its batch counterpart that loops over collected indices.
+     * See UBaseViewBlueprintExtension::IsSingleDispatchFunction
+     */
+    class UNREALMVVM_API FBlueprintDispatchBatch
+    {
+    public:
+        UE_NONCOPYABLE(FBlueprintDispatchBatch);
+
+        explicit FBlueprintDispatchBatch(UObject* InView)
+            : View(InView)
+            , Previous(Current)
+        {
+            Current = this;
+        }
+
+        ~FBlueprintDispatchBatch();
+
+        /* Returns batch that collects bindings of given View, nullptr if there is none */
+        static FBlueprintDispatchBatch* Find(UObject* View)
+        {
+            return Current != nullptr && Current->View == View ? Current : nullptr;
+        }
+
+        /* Schedules call of DispatchFunction with given index */
+        void Add(UFunction* DispatchFunction, int32 DispatchIndex);
+
+    private:
+        struct FPendingDispatch
+        {
+            UFunction* Function;
+            TArray<int32> Indices;
+        };
+
+        UObject* View;
+        FBlueprintDispatchBatch* Previous;
+
+        // each Blueprint in View class hierarchy has its own dispatch event
+        TArray<FPendingDispatch, TInlineAllocator<2>> Pending;
+
+        static FBlueprintDispatchBatch* Current;
+    };
+
     struct FBlueprintPropertyChangeHandler : public IPropertyChangeHandler
     {
-        FBlueprintPropertyChangeHandler(UObject* InBaseView, UFunction* InFunction)
-            : BaseView(InBaseView), Function(InFunction)
+        FBlueprintPropertyChangeHandler(UObject* InBaseView, UFunction* InFunction, int32 InDispatchIndex)
+            : BaseView(InBaseView), Function(InFunction), DispatchIndex(InDispatchIndex)
         {
         }
 
         void Invoke(UBaseViewModel*, const FViewModelPropertyBase*) const override
         {
-            BaseView->ProcessEvent(Function, nullptr);
+            if (DispatchIndex == INDEX_NONE)
+            {
+                BaseView->ProcessEvent(Function, nullptr);
+            }
+            else if (FBlueprintDispatchBatch* Batch = FBlueprintDispatchBatch::Find(BaseView))
+            {
+                // View is being initialized, all of its bindings are dispatched at once
+                Batch->Add(Function, DispatchIndex);
+            }
+            else
+            {
+                // dispatch event takes index of binding as its only parameter
+                int32 Parms = DispatchIndex;
+                BaseView->ProcessEvent(Function, &Parms);
+            }
         }
 
         UObject* BaseView;
         UFunction* Function;
+        int32 DispatchIndex;
+    };
+
+    /* Writes value of ViewModel property directly into property of View. See FPropertyBindingEntry */
+    struct UNREALMVVM_API FDirectPropertyChangeHandler : public IPropertyChangeHandler
+    {
+        FDirectPropertyChangeHandler(UObject* InBaseView, const TSharedRef<const FViewRegistry::FPropertyBinding>& InBinding)
+            : BaseView(InBaseView), Binding(InBinding)
+        {
+        }
+
+        void Invoke(UBaseViewModel* ViewModel, const FViewModelPropertyBase*) const override;
+
+        /* Returns whether property holds ESlateVisibility value */
+        static bool IsVisibilityProperty(const FProperty* Property);
+
+        UObject* BaseView;
+        TSharedRef<const FViewRegistry::FPropertyBinding> Binding;
     };
 
     template<typename TOwner, typename TViewModel, typename TComponent>
@@ -40,8 +116,7 @@ namespace UnrealMvvm_Impl
         /* Calls ViewModelChanged event, if it exist in blueprint class */
         static void TryCallViewModelChanged(UObject* ViewObject, UBaseViewModel* OldViewModel, UBaseViewModel* NewViewModel)
         {
-            UClass* Class = ViewObject->GetClass();
-            UFunction* Function = Class->FindFunctionByName(ViewModelChangedFunctionName);
+            UFunction* Function = FViewRegistry::GetBlueprintFunctions(ViewObject->GetClass()).ViewModelChanged;
 
             if (Function)
             {
@@ -53,13 +128,16 @@ namespace UnrealMvvm_Impl
         /* Adds bindings to BindingWorker */
         static void PrepareBindindsInternal(UObject* ViewObject, FBindingWorker& Worker)
         {
-            const FBindingConfiguration* FoundConfiguration = FViewRegistry::GetBindingConfiguration(ViewObject->GetClass());
-            if (!FoundConfiguration)
+            const FViewRegistry::FViewBindings* FoundBindings = FViewRegistry::GetViewBindings(ViewObject->GetClass());
+            if (!FoundBindings)
             {
                 return;
             }
 
-            Worker.Init(ViewObject, *FoundConfiguration);
+            Worker.Init(ViewObject, FoundBindings->Configuration);
+
+            // handlers are added in the same order as during CreateBindingConfiguration, so their locations are already known
+            FBindingWorker::FHandlerSlotsScope SlotsScope(Worker, FoundBindings->HandlerSlots, FoundBindings->ParentProperties);
 
             // native bindings
             FViewRegistry::FBindingsCollectorPtr BindingsCollector = FViewRegistry::GetBindingsCollector(ViewObject->GetClass());
@@ -69,13 +147,25 @@ namespace UnrealMvvm_Impl
             }
 
             // blueprint bindings
-            UViewModelDynamicBinding* ViewModelDynamicBinding = static_cast<UViewModelDynamicBinding*>(UBlueprintGeneratedClass::GetDynamicBindingObject(ViewObject->GetClass(), UViewModelDynamicBinding::StaticClass()));
-            if (ViewModelDynamicBinding != nullptr)
+            const FViewRegistry::FBlueprintFunctions& Functions = FViewRegistry::GetBlueprintFunctions(ViewObject->GetClass());
+            if (Functions.DynamicBinding != nullptr)
             {
-                for (const FBlueprintBindingEntry& Binding : ViewModelDynamicBinding->BlueprintBindings)
+                const TArray<FBlueprintBindingEntry>& BlueprintBindings = Functions.DynamicBinding->BlueprintBindings;
+                check(BlueprintBindings.Num() == Functions.BindingHandlers.Num());
+
+                for (int32 Index = 0; Index < BlueprintBindings.Num(); ++Index)
                 {
-                    UFunction* Function = ViewObject->FindFunction(Binding.FunctionName);
-                    Worker.AddBindingHandler<FBlueprintPropertyChangeHandler>(Binding.PropertyPath, ViewObject, Function);
+                    const FBlueprintBindingEntry& Binding = BlueprintBindings[Index];
+                    Worker.AddBindingHandler<FBlueprintPropertyChangeHandler>(Binding.PropertyPath, ViewObject, Functions.BindingHandlers[Index], Binding.DispatchIndex);
+                }
+
+                // property bindings go after blueprint ones, same as in CreateBindingConfiguration
+                const TArray<FPropertyBindingEntry>& PropertyBindings = Functions.DynamicBinding->PropertyBindings;
+                check(PropertyBindings.Num() == Functions.PropertyBindings.Num());
+
+                for (int32 Index = 0; Index < PropertyBindings.Num(); ++Index)
+                {
+                    Worker.AddBindingHandler<FDirectPropertyChangeHandler>(PropertyBindings[Index].PropertyPath, ViewObject, Functions.PropertyBindings[Index]);
                 }
             }
         }
@@ -83,9 +173,20 @@ namespace UnrealMvvm_Impl
         static void InvokeStartListening(UObject* ViewObject, FBindingWorker& Worker)
         {
             UnrealMvvm_Impl::FViewInitializationScope Scope(ViewObject, Worker.GetViewModel());
+
+            // batch is dispatched before initialization scope ends, so Blueprint handlers still see it
+            FBlueprintDispatchBatch Batch(ViewObject);
             Worker.StartListening();
         }
 
+        static void InvokeRebindViewModel(UObject* ViewObject, FBindingWorker& Worker, UBaseViewModel* NewViewModel)
+        {
+            UnrealMvvm_Impl::FViewInitializationScope Scope(ViewObject, NewViewModel);
+
+            FBlueprintDispatchBatch Batch(ViewObject);
+            Worker.RebindViewModel(NewViewModel);
+        }
+
         /* Name of UFunction to call when ViewModel changes */
         static FName ViewModelChangedFunctionName;
     };
@@ -103,6 +204,15 @@ namespace UnrealMvvm_Impl
 
             UBaseViewModel* OldViewModel = ThisView->ViewModel;
 
+            if (OldViewModel && InViewModel && ThisView->IsConstructed() && ThisView->BindingWorker.IsDiffRebindEnabled())
+            {
+                // invoke only handlers whose values differ between ViewModels
+                ThisView->ViewModel = InViewModel;
+                TryCallViewModelChanged(ThisView->GetViewObject(), OldViewModel, InViewModel);
+                InvokeRebindViewModel(ThisView->GetViewObject(), ThisView->BindingWorker, InViewModel);
+                return;
+            }
+
             if (OldViewModel && ThisView->IsConstructed())
             {
                 ThisView->BindingWorker.StopListening();
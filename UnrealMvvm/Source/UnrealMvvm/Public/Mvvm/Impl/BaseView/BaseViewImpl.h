@@ -5,6 +5,8 @@
 #include "Mvvm/ViewModelProperty.h"
 #include "Mvvm/Impl/BaseView/BaseViewExtension.h"
 #include "Mvvm/Impl/BaseView/BaseViewComponent.h"
+#include "Mvvm/Impl/BaseView/ActorViewSubsystem.h"
+#include <type_traits>
 
 template<typename TOwner, typename TViewModel>
 class TBaseView;
@@ -19,12 +21,18 @@ namespace UnrealMvvm_Impl
 
         static TViewModel* GetViewModel(const FView* BaseView)
         {
-            return (TViewModel*)GetExtension(BaseView)->ViewModel;
+            TComponent* Extension = GetExtension(BaseView);
+            return Extension ? (TViewModel*)Extension->ViewModel : nullptr;
         }
 
         static void SetViewModel(FView* BaseView, TViewModel* InViewModel)
         {
             TComponent* Extension = GetExtension(BaseView);
+            if (!Extension)
+            {
+                // View has no place to store ViewModel, e.g. it is a CDO or Actor without UActorViewSubsystem
+                return;
+            }
 
             TViewModel* OldViewModel = (TViewModel*)Extension->ViewModel;
 
@@ -39,7 +47,7 @@ namespace UnrealMvvm_Impl
                 const_cast<FView*>(BaseView)->CachedComponent = TComponent::Request(const_cast<TOwner*>(static_cast<const TOwner*>(BaseView)));
             }
 
-            return (TComponent*)BaseView->CachedComponent;
+            return static_cast<TComponent*>(BaseView->CachedComponent);
         }
 
         static auto& GetBindingWorker(const FView* BaseView)
@@ -48,6 +56,19 @@ namespace UnrealMvvm_Impl
         }
     };
 
+    /* Reads EActorViewStorage declared by Actor View. Defaults to Component */
+    template<typename TOwner, typename = void>
+    struct TActorViewStorage
+    {
+        static constexpr EActorViewStorage Value = EActorViewStorage::Component;
+    };
+
+    template<typename TOwner>
+    struct TActorViewStorage<TOwner, std::void_t<decltype(TOwner::ViewStorage)>>
+    {
+        static constexpr EActorViewStorage Value = TOwner::ViewStorage;
+    };
+
     template<typename TOwner, typename TViewModel, typename = void>
     class TBaseViewImpl;
 
@@ -60,11 +81,18 @@ namespace UnrealMvvm_Impl
 
     /* Implementation for Actor */
     template<typename TOwner, typename TViewModel>
-    class TBaseViewImpl<TOwner, TViewModel, typename TEnableIf<TIsDerivedFrom<TOwner, AActor>::Value>::Type>
+    class TBaseViewImpl<TOwner, TViewModel, typename TEnableIf<TIsDerivedFrom<TOwner, AActor>::Value && TActorViewStorage<TOwner>::Value == EActorViewStorage::Component>::Type>
         : public TBaseViewImplWithComponent<TOwner, TViewModel, UBaseViewComponent>
     {
     };
 
+    /* Implementation for Actor that keeps its bindings in UActorViewSubsystem */
+    template<typename TOwner, typename TViewModel>
+    class TBaseViewImpl<TOwner, TViewModel, typename TEnableIf<TIsDerivedFrom<TOwner, AActor>::Value && TActorViewStorage<TOwner>::Value == EActorViewStorage::Subsystem>::Type>
+        : public TBaseViewImplWithComponent<TOwner, TViewModel, FActorViewEntry>
+    {
+    };
+
     template <typename TResultType, typename... TProps>
     struct TPropertyPathValidator;
 
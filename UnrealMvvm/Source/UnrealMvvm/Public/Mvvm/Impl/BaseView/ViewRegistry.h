@@ -3,15 +3,22 @@
 #pragma once
 
 #include "Mvvm/Impl/Binding/BindingConfiguration.h"
+#include "Templates/SharedPointer.h"
 
 class UClass;
 class UObject;
+class UFunction;
+class UViewModelDynamicBinding;
 class UBaseViewModel;
 class FViewModelPropertyBase;
+class FProperty;
+struct FPropertyBindingEntry;
+enum class EPropertyBindingConversion : uint8;
 
 namespace UnrealMvvm_Impl
 {
     class FBindingConfigurationBuilder;
+    struct FViewModelPropertyReflection;
 
     class UNREALMVVM_API FViewRegistry
     {
@@ -20,6 +27,49 @@ namespace UnrealMvvm_Impl
         using FViewModelSetterPtr = void (*)(UObject&, UBaseViewModel*);
         using FBindingsCollectorPtr = void (*)(UObject&);
 
+        /* Binding configuration of a View class together with precomputed locations of its handlers */
+        struct FViewBindings
+        {
+            FBindingConfiguration Configuration;
+
+            /* Index of property entry for each Bind call, Native ones first and then Blueprint ones. See FBindingWorker::FHandlerSlotsScope */
+            TArray<int32> HandlerSlots;
+
+            /* Index of property entry leading to ViewModel of each property entry, used to validate HandlerSlots */
+            TArray<int32> ParentProperties;
+        };
+
+        /* Entry of DynamicBinding->PropertyBindings resolved against View and ViewModel classes */
+        struct FPropertyBinding
+        {
+            /* Bound ViewModel property, nullptr if binding could not be resolved */
+            const FViewModelPropertyReflection* Source = nullptr;
+
+            /* Properties leading from View object to target property */
+            TArray<FProperty*> TargetPath;
+
+            EPropertyBindingConversion Conversion{};
+        };
+
+        /* Blueprint functions of a View class. Resolved once per class and shared between all its instances */
+        struct FBlueprintFunctions
+        {
+            /* OnVM_ViewModelChanged event, may be nullptr */
+            UFunction* ViewModelChanged = nullptr;
+
+            /* Dynamic binding object of a class, may be nullptr */
+            UViewModelDynamicBinding* DynamicBinding = nullptr;
+
+            /* Handler for each entry in DynamicBinding->BlueprintBindings, in the same order */
+            TArray<UFunction*> BindingHandlers;
+
+            /* Batch event for each dispatch event used by BindingHandlers. See FBlueprintDispatchBatch */
+            TMap<UFunction*, UFunction*> DispatchBatchHandlers;
+
+            /* Resolved entry for each entry in DynamicBinding->PropertyBindings, in the same order. Shared with handlers of View instances */
+            TArray<TSharedRef<const FPropertyBinding>> PropertyBindings;
+        };
+
         static void ProcessPendingRegistrations();
 
         static UClass* GetViewModelClass(UClass* ViewClass);
@@ -27,14 +77,22 @@ namespace UnrealMvvm_Impl
         static FViewModelSetterPtr GetViewModelSetter(UClass* ViewClass);
         static FBindingsCollectorPtr GetBindingsCollector(UClass* ViewClass);
         static const FBindingConfiguration* GetBindingConfiguration(UClass* ViewClass);
+        static const FViewBindings* GetViewBindings(UClass* ViewClass);
+        static const FBlueprintFunctions& GetBlueprintFunctions(UClass* ViewClass);
+
+        /* Returns whether native Actor View class keeps its bindings in UActorViewSubsystem. See EActorViewStorage */
+        static bool UsesActorViewSubsystem(UClass* ViewClass);
 
-        static uint8 RegisterViewClass(FClassGetterPtr ViewClassGetter, FClassGetterPtr ViewModelClassGetter, FViewModelSetterPtr ViewModelSetter, FBindingsCollectorPtr BindingsCollector);
+        static uint8 RegisterViewClass(FClassGetterPtr ViewClassGetter, FClassGetterPtr ViewModelClassGetter, FViewModelSetterPtr ViewModelSetter, FBindingsCollectorPtr BindingsCollector, bool bUsesActorViewSubsystem = false);
         static void RegisterViewClass(UClass* ViewClass, UClass* ViewModelClass);
 
 #if WITH_EDITOR
         static void UnregisterViewClass(UClass* ViewClass);
 #endif
 
+        /* Drops resolved Blueprint functions of ViewClass and all its subclasses. Drops everything if ViewClass is nullptr */
+        static void InvalidateBlueprintFunctions(UClass* ViewClass);
+
         static bool RecordPropertyPath(TArrayView<const FViewModelPropertyBase* const> PropertyPath);
 
 #if WITH_EDITOR
@@ -50,9 +108,12 @@ namespace UnrealMvvm_Impl
             FClassGetterPtr GetViewModelClass;
             FViewModelSetterPtr ViewModelSetter;
             FBindingsCollectorPtr BindingsCollector;
+            bool bUsesActorViewSubsystem;
         };
 
         static void CreateBindingConfiguration(UClass* ViewClass, UClass* ViewModelClass);
+        static void ResolveBlueprintFunctions(UClass* ViewClass, FBlueprintFunctions& Functions);
+        static void ResolvePropertyBinding(UClass* ViewClass, const FPropertyBindingEntry& Entry, FPropertyBinding& OutBinding);
 
         // List of view model classes that were not yet added to lookup table
         static TArray<FUnprocessedViewClassEntry>& GetUnprocessedViewClasses();
@@ -63,11 +124,17 @@ namespace UnrealMvvm_Impl
         // Map of <ViewClass, Setter Function>
         static TMap<UClass*, FViewModelSetterPtr> ViewModelSetters;
 
+        // Native Actor View classes that use EActorViewStorage::Subsystem
+        static TSet<UClass*> ActorViewSubsystemClasses;
+
         // Map of <ViewClass, Collector Function>
         static TMap<UClass*, FBindingsCollectorPtr> BindingsCollectors;
 
         // Map of <ViewClass, Resolved Binding Configuration>
-        static TMap<TWeakObjectPtr<UClass>, FBindingConfiguration> BindingConfigurations;
+        static TMap<TWeakObjectPtr<UClass>, FViewBindings> BindingConfigurations;
+
+        // Map of <ViewClass, Resolved Blueprint Functions>
+        static TMap<TWeakObjectPtr<UClass>, FBlueprintFunctions> BlueprintFunctions;
 
         // Current list of Native handlers that we collect
         static FBindingConfigurationBuilder* CurrentConfigurationBuilder;
@@ -6,9 +6,13 @@
 // Use #include "Mvvm/BaseView.h"
 
 #include "Mvvm/Impl/Binding/BindingWorker.h"
+#include "Mvvm/Impl/Binding/TextFormattingCache.h"
+#include "Mvvm/Impl/Binding/TwoWayBindingProxy.h"
 #include "Mvvm/Impl/Utils/VariadicHelpers.h"
+#include "Mvvm/ValueConverters.h"
 #include "Containers/StaticArray.h"
 #include "Templates/IsInvocable.h"
+#include <functional>
 #include <type_traits>
 
 namespace UnrealMvvm_Impl
@@ -33,7 +37,39 @@ namespace UnrealMvvm_Impl
         static const bool Value = std::is_same_v<decltype(Test<T>(0)), FText>;
     };
 
-    template <typename TOwner, typename TValue, typename TCallback>
+    // checks whether method T::GetText() returning FText exists
+    template <typename T>
+    struct THasGetText
+    {
+        template<typename U> static decltype(DeclVal<const U&>().GetText()) Test(int);
+        template<typename U> static void Test(...);
+
+        static const bool Value = std::is_convertible_v<decltype(Test<T>(0)), FText>;
+    };
+
+    template <typename TTextBlock>
+    using TTextBlockType = typename TRemovePointer<typename TRemoveObjectPointer<TTextBlock>::Type>::Type;
+
+    // base of callbacks created by Bind overloads that set text, they are invoked again by FBindingWorker::RefreshTextBindings.
+    // Callbacks do not keep copies of last texts, so they fit into handler buffer. They compare with text shown by TextBlock instead
+    struct FTextBindingTag
+    {
+        // skip checks are ignored after texts were invalidated and before the first text is set
+        bool IsUpToDate() const
+        {
+            return Generation == FNumberTextCache::GetGeneration();
+        }
+
+        void MarkUpToDate() const
+        {
+            Generation = FNumberTextCache::GetGeneration();
+        }
+
+        // zero is never returned by FNumberTextCache::GetGeneration
+        mutable uint32 Generation = 0;
+    };
+
+    template <typename TOwner, typename TValue, typename TCallback, bool bStructViewModel = std::is_base_of_v<FBaseStructViewModel, TOwner>>
     struct TBindingPropertyChangeHandler : public IPropertyChangeHandler
     {
         TBindingPropertyChangeHandler(TCallback&& InCallback)
@@ -47,9 +83,235 @@ namespace UnrealMvvm_Impl
             Callback(CastedProperty->GetValue((TOwner*)ViewModel));
         }
 
+        bool IsTextBinding() const override
+        {
+            return std::is_base_of_v<FTextBindingTag, TCallback>;
+        }
+
+        TCallback Callback;
+    };
+
+    // same handler for ViewModels derived from FBaseStructViewModel, used by TStructViewModelBinding
+    template <typename TOwner, typename TValue, typename TCallback>
+    struct TBindingPropertyChangeHandler<TOwner, TValue, TCallback, true> : public IStructPropertyChangeHandler
+    {
+        TBindingPropertyChangeHandler(TCallback&& InCallback)
+            : Callback(InCallback)
+        {
+        }
+
+        void Invoke(FBaseStructViewModel* ViewModel, const FViewModelPropertyBase* Property) const override
+        {
+            auto CastedProperty = (TViewModelProperty<TOwner, TValue>*)Property;
+            Callback(CastedProperty->GetValue(static_cast<TOwner*>(ViewModel)));
+        }
+
         TCallback Callback;
     };
 
+    // sets FText value to TextBlock, skips SetText if TextBlock already shows identical text
+    template <typename TTextBlock>
+    struct TTextSetter : FTextBindingTag
+    {
+        TTextSetter(TTextBlock InText)
+            : Text(InText)
+        {
+        }
+
+        void operator()(const FText& Value) const
+        {
+            if constexpr (THasGetText<TTextBlockType<TTextBlock>>::Value)
+            {
+                if (IsUpToDate() && Text->GetText().IdenticalTo(Value))
+                {
+                    return;
+                }
+            }
+
+            MarkUpToDate();
+            Text->SetText(Value);
+        }
+
+        TTextBlock Text;
+    };
+
+    // sets FString value to TextBlock, skips SetText if TextBlock already shows the same string
+    template <typename TTextBlock>
+    struct TStringToTextSetter : FTextBindingTag
+    {
+        TStringToTextSetter(TTextBlock InText)
+            : Text(InText)
+        {
+        }
+
+        void operator()(const FString& Value) const
+        {
+            if constexpr (THasGetText<TTextBlockType<TTextBlock>>::Value)
+            {
+                const FText CurrentText = Text->GetText();
+                if (IsUpToDate() && CurrentText.ToString().Equals(Value, ESearchCase::CaseSensitive))
+                {
+                    return;
+                }
+            }
+
+            MarkUpToDate();
+            Text->SetText(FText::FromString(Value));
+        }
+
+        TTextBlock Text;
+    };
+
+    // formats numeric value via FNumberTextCache and sets it to TextBlock, skips SetText if value or formatted text was not changed
+    template <typename TTextBlock, typename TValue>
+    struct TNumberToTextSetter : FTextBindingTag
+    {
+        TNumberToTextSetter(TTextBlock InText, int32 InFormatIndex)
+            : FormatIndex(InFormatIndex)
+            , Text(InText)
+        {
+        }
+
+        void operator()(TValue Value) const
+        {
+            const bool bUpToDate = IsUpToDate();
+            if (bUpToDate && LastValue == Value)
+            {
+                return;
+            }
+
+            MarkUpToDate();
+            LastValue = Value;
+
+            FText NewText = FNumberTextCache::Format(Value, FormatIndex);
+
+            if constexpr (THasGetText<TTextBlockType<TTextBlock>>::Value)
+            {
+                const FText CurrentText = Text->GetText();
+                if (bUpToDate && CurrentText.ToString().Equals(NewText.ToString(), ESearchCase::CaseSensitive))
+                {
+                    return;
+                }
+            }
+
+            Text->SetText(NewText);
+        }
+
+        // declared first, so it fits next to Generation of the base
+        int32 FormatIndex;
+        TTextBlock Text;
+        mutable TValue LastValue{};
+    };
+
+    template <bool bTextBinding>
+    struct TConvertingSetterBase
+    {
+    };
+
+    template <>
+    struct TConvertingSetterBase<true> : FTextBindingTag
+    {
+    };
+
+    /*
+     * Passes value through converter and applies result to Target. Target is either a callable or an object that accepts result:
+     * SetText for FText, SetVisibility for ESlateVisibility, SetBrush for FSlateBrush
+     */
+    template <typename TValue, typename TConverter, typename TTarget>
+    struct TConvertingSetter : TConvertingSetterBase<std::is_same_v<std::decay_t<decltype(DeclVal<const TConverter&>()(DeclVal<const TValue&>()))>, FText>>
+    {
+        using FResultType = std::decay_t<decltype(DeclVal<const TConverter&>()(DeclVal<const TValue&>()))>;
+
+        TConvertingSetter(const TConverter& InConverter, TTarget InTarget)
+            : Converter(InConverter)
+            , Target(InTarget)
+        {
+        }
+
+        void operator()(const TValue& Value) const
+        {
+            decltype(auto) Result = Converter(Value);
+
+            if constexpr (TIsInvocable<const TTarget&, FResultType>::Value)
+            {
+                Target(Result);
+            }
+            else if constexpr (std::is_same_v<FResultType, FText>)
+            {
+                Target->SetText(Result);
+            }
+            else if constexpr (std::is_same_v<FResultType, ESlateVisibility>)
+            {
+                Target->SetVisibility(Result);
+            }
+            else if constexpr (std::is_same_v<FResultType, FSlateBrush>)
+            {
+                Target->SetBrush(Result);
+            }
+            else
+            {
+                static_assert(sizeof(TTarget) == 0, "Target cannot accept result of converter");
+            }
+        }
+
+        TConverter Converter;
+        TTarget Target;
+    };
+
+    /*
+     * Handler of two-way binding. Sets ViewModel value to widget and subscribes to widget event to write changes back.
+     * Subscription lives as long as the handler, i.e. until bindings of the View are destroyed
+     */
+    template <typename TView, typename TProperty, typename TWidget, typename TSetter, typename TEventPtr>
+    struct TTwoWayBindingHandler : public IPropertyChangeHandler
+    {
+        using FEventType = std::remove_reference_t<decltype(std::mem_fn(DeclVal<TEventPtr>())(DeclVal<TWidget*>()))>;
+        using FEventArgs = decltype(DeduceDelegateArgs(&FEventType::Broadcast));
+        using FEventValue = typename TTupleElement<0, FEventArgs>::Type;
+
+        static_assert(std::is_convertible_v<FEventValue, typename TProperty::FValueType>, "First parameter of widget event must be convertible to property value");
+
+        using FState = TTwoWayBindingState<TView, TProperty, TWidget, TSetter, FEventValue>;
+
+        TTwoWayBindingHandler(TView* View, const TProperty* Property, TWidget* InWidget, TSetter InSetter, TEventPtr InEvent)
+            : Widget(InWidget)
+            , Event(InEvent)
+            , State(MakeShared<FState>(View, Property, InWidget, InSetter))
+        {
+            Proxy = UTwoWayBindingProxy::Create(State);
+
+            FScriptDelegate Delegate;
+            Delegate.BindUFunction(Proxy, UTwoWayBindingProxy::GetForwardFunctionName());
+            std::mem_fn(Event)(InWidget).Add(Delegate);
+        }
+
+        ~TTwoWayBindingHandler()
+        {
+            if (TWidget* WidgetPtr = Widget.Get())
+            {
+                std::mem_fn(Event)(WidgetPtr).RemoveAll(Proxy);
+            }
+
+            Proxy->Release();
+        }
+
+        void Invoke(UBaseViewModel* ViewModel, const FViewModelPropertyBase* Property) const override
+        {
+            // value came from this widget, State sets it back only if ViewModel changed it while writing
+            if (State->IsWriting())
+            {
+                return;
+            }
+
+            auto CastedProperty = (const TProperty*)Property;
+            State->ApplyToWidget(CastedProperty->GetValue((typename TProperty::FViewModelType*)ViewModel));
+        }
+
+        TWeakObjectPtr<TWidget> Widget;
+        TEventPtr Event;
+        TSharedRef<FState> State;
+        UTwoWayBindingProxy* Proxy;
+    };
 
     template <typename TViewModel, typename TValue, uint32 Size>
     struct TPropertyPath
@@ -111,6 +373,8 @@ void __BindImpl(TOwner* ThisPtr, TPropertyPath PropertyPath, TCallback&& Callbac
     }
     else
     {
+        static_assert(!std::is_base_of_v<FBaseStructViewModel, ViewModelType>, "Property Paths are not supported by struct ViewModels");
+
         ThisPtr->template EmplaceHandler<TBindingPropertyChangeHandler<ViewModelType, typename TPropertyPath::FValueType, TCallback>>(PropertyPath.ToArrayView(), Forward<TCallback>(Callback));
     }
 }
@@ -137,7 +401,7 @@ typename TEnableIf<std::is_same_v<UnrealMvvm_Impl::TPropertyValueType_T<TPropert
 Bind(TOwner* ThisPtr, TProperty Property, TTextBlock Text)
 {
     check(Text || ThisPtr->IsTemplate());
-    __BindImpl(ThisPtr, Property, [Text](UnrealMvvm_Impl::TPropertyValueType_T<TProperty> V) { Text->SetText(V); });
+    __BindImpl(ThisPtr, Property, UnrealMvvm_Impl::TTextSetter<TTextBlock>{ Text });
 }
 
 // Binds FString property to UTextBlock or any other class that has SetText method
@@ -146,7 +410,7 @@ typename TEnableIf<std::is_same_v<UnrealMvvm_Impl::TPropertyValueType_T<TPropert
 Bind(TOwner* ThisPtr, TProperty Property, TTextBlock Text)
 {
     check(Text || ThisPtr->IsTemplate());
-    __BindImpl(ThisPtr, Property, [Text](UnrealMvvm_Impl::TPropertyValueType_T<TProperty> V) { Text->SetText(FText::FromString(V)); });
+    __BindImpl(ThisPtr, Property, UnrealMvvm_Impl::TStringToTextSetter<TTextBlock>{ Text });
 }
 
 // Binds numeric property to UTextBlock or any other class that has SetText method
@@ -155,12 +419,54 @@ typename TEnableIf<UnrealMvvm_Impl::THasNumberToText<UnrealMvvm_Impl::TPropertyV
 Bind(TOwner* ThisPtr, TProperty Property, TTextBlock Text, const FNumberFormattingOptions* const Options = nullptr, const FCulturePtr& TargetCulture = nullptr)
 {
     check(Text || ThisPtr->IsTemplate());
-    if (Options)
+
+    using FSetter = UnrealMvvm_Impl::TNumberToTextSetter<TTextBlock, UnrealMvvm_Impl::TPropertyValueType_T<TProperty>>;
+    __BindImpl(ThisPtr, Property, FSetter{ Text, UnrealMvvm_Impl::FNumberTextCache::GetFormatIndex(Options, TargetCulture) });
+}
+
+// Binds property to a lambda, a method or a widget through value converters, e.g. MvvmConverters::Clamp(0.f, 1.f) | MvvmConverters::ToPercentText()
+template<typename TOwner, typename TProperty, typename TConverter, typename TTarget>
+typename TEnableIf< UnrealMvvm_Impl::TIsValueConverter<TConverter>::Value >::Type
+Bind(TOwner* ThisPtr, TProperty Property, TConverter Converter, TTarget Target)
+{
+    using namespace UnrealMvvm_Impl;
+    using FValueType = TPropertyValueType_T<TProperty>;
+
+    if constexpr (std::is_member_pointer_v<TTarget>)
     {
-        __BindImpl(ThisPtr, Property, [Text, Options = *Options, TargetCulture](UnrealMvvm_Impl::TPropertyValueType_T<TProperty> V) { Text->SetText(FText::AsNumber(V, &Options, TargetCulture)); });
+        auto Setter = [ThisPtr, Target](auto&& V) { (ThisPtr->*Target)(V); };
+        __BindImpl(ThisPtr, Property, TConvertingSetter<FValueType, TConverter, decltype(Setter)>{ Converter, Setter });
     }
     else
     {
-        __BindImpl(ThisPtr, Property, [Text, TargetCulture](UnrealMvvm_Impl::TPropertyValueType_T<TProperty> V) { Text->SetText(FText::AsNumber(V, nullptr, TargetCulture)); });
+        using FSetter = TConvertingSetter<FValueType, TConverter, TTarget>;
+
+        if constexpr (!TIsInvocable<const TTarget&, typename FSetter::FResultType>::Value)
+        {
+            check(Target || ThisPtr->IsTemplate());
+        }
+
+        __BindImpl(ThisPtr, Property, FSetter{ Converter, Target });
     }
 }
+
+/*
+ * Binds property to a widget in both directions, e.g. BindTwoWay(this, ViewModelType::VolumeProperty(), Slider_Volume, &USlider::SetValue, &USlider::OnValueChanged)
+ * ViewModel value is applied to widget via Setter. Values broadcasted by widget Event are written into ViewModel via property setter once per frame,
+ * the resulting change notification is not applied back to the same widget
+ */
+template<typename TOwner, typename TPropertyViewModel, typename TValue, typename TWidget, typename TSetter, typename TEventPtr>
+void BindTwoWay(TOwner* ThisPtr, const TViewModelProperty<TPropertyViewModel, TValue>* Property, TWidget Widget, TSetter Setter, TEventPtr Event)
+{
+    using namespace UnrealMvvm_Impl;
+    using ViewModelType = typename TOwner::ViewModelType;
+    using FWidgetType = typename TRemovePointer<typename TRemoveObjectPointer<TWidget>::Type>::Type;
+    using FPropertyType = TViewModelProperty<TPropertyViewModel, TValue>;
+
+    static_assert(TIsDerivedFrom<ViewModelType, TPropertyViewModel>::Value, "Property must be declared in TOwner's ViewModel type");
+    check(Widget || ThisPtr->IsTemplate());
+    check(Property->HasSetter());
+
+    using FHandler = TTwoWayBindingHandler<TOwner, FPropertyType, FWidgetType, TSetter, TEventPtr>;
+    ThisPtr->template EmplaceHandler<FHandler>({ Property }, ThisPtr, Property, static_cast<FWidgetType*>(Widget), Setter, Event);
+}
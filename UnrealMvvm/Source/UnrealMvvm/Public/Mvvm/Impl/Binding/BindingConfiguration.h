@@ -4,6 +4,7 @@
 
 #include "Mvvm/ViewModelProperty.h"
 #include "Mvvm/Impl/Binding/IPropertyChangeHandler.h"
+#include "Mvvm/Impl/Binding/ViewModelSubscribers.h"
 #include "Containers/ArrayView.h"
 #include "Templates/TypeCompatibleBytes.h"
 #include "Algo/AllOf.h"
@@ -28,6 +29,9 @@ namespace UnrealMvvm_Impl
         int32 FirstProperty;
         int32 NumProperties;
 
+        // only valid in "instanced" version while subscribed to ViewModel
+        FViewModelSubscriptionHandle SubscriptionHandle;
+
         friend bool operator== (const FResolvedViewModelEntry& Entry, UBaseViewModel* InViewModel)
         {
             return Entry.ViewModel == InViewModel;
@@ -36,7 +40,7 @@ namespace UnrealMvvm_Impl
 
     struct FResolvedPropertyEntry
     {
-        FResolvedPropertyEntry(const FViewModelPropertyBase* InProperty, int8 InNextViewModelIndex)
+        FResolvedPropertyEntry(const FViewModelPropertyBase* InProperty, int32 InNextViewModelIndex)
             : Property(InProperty)
             , NextViewModelIndex(InNextViewModelIndex)
             , bHasHandler(false)
@@ -69,7 +73,7 @@ namespace UnrealMvvm_Impl
 
             bHasHandler = true;
             bInline = bInlineConstexpr;
-            HandlerSize = sizeof(THandler); // for analytics
+            HandlerSize = (int8)FMath::Min<int32>(sizeof(THandler), MAX_int8); // for analytics, saturated
 
             if constexpr (!bInlineConstexpr)
             {
@@ -105,7 +109,9 @@ namespace UnrealMvvm_Impl
         static constexpr int32 HandlerBufferSize = sizeof(void*) * 4;
 
         const FViewModelPropertyBase* Property;
-        int8 NextViewModelIndex;
+
+        // int32 fits into padding before HandlerBuffer, so it does not increase size of entry
+        int32 NextViewModelIndex;
         bool bHasHandler;
         bool bInline;
         int8 HandlerSize;
@@ -131,7 +137,27 @@ namespace UnrealMvvm_Impl
 
             // whether owning BindingWorker has subscribed to root ViewModel
             // we store the flag here to save 8 bytes of memory inside BindingWorker
-            bool bHasSubscription;
+            bool bHasSubscription : 1;
+
+            // whether owning BindingWorker invokes only changed handlers when root ViewModel is replaced
+            bool bDiffRebind : 1;
+
+            // whether owning BindingWorker invokes only changed handlers when ViewModel in the middle of Path is replaced
+            bool bDiffPropagation : 1;
+
+            // whether sizes are stored in FWideHeader, fields above are unused in that case
+            bool bWide : 1;
+        };
+
+        /* Header used by configurations that do not fit into limits of compact FHeader */
+        struct FWideHeader
+        {
+            FHeader Header;
+
+            int32 Size;
+            int32 PropertiesOffset;
+            int32 NumViewModels;
+            int32 NumProperties;
         };
 
         FBindingConfiguration() : Data(nullptr) {}
@@ -145,19 +171,44 @@ namespace UnrealMvvm_Impl
             *this = MoveTemp(Other);
         }
 
-        FBindingConfiguration(uint8 NumViewModels, uint8 NumProperties)
+        FBindingConfiguration(int32 NumViewModels, int32 NumProperties)
         {
-            const int32 PropertiesOffset = ViewModelsOffset + sizeof(FResolvedViewModelEntry) * NumViewModels;
-            int32 DataSize = PropertiesOffset + sizeof(FResolvedPropertyEntry) * NumProperties;
+            check(NumViewModels >= 0 && NumProperties >= 0);
+
+            // small configurations use compact header, large ones switch to wide header
+            const bool bWide = !FitsCompactHeader(NumViewModels, NumProperties);
+            const int64 PropertiesOffset = (bWide ? WideViewModelsOffset : ViewModelsOffset) + (int64)sizeof(FResolvedViewModelEntry) * NumViewModels;
+            const int64 DataSize = PropertiesOffset + (int64)sizeof(FResolvedPropertyEntry) * NumProperties;
+            checkf(DataSize <= MAX_int32, TEXT("Binding configuration is too large: %d ViewModels, %d Properties"), NumViewModels, NumProperties);
 
             Data = (uint8*)FMemory::Malloc(DataSize);
 
             FHeader* Header = (FHeader*)Data;
-            Header->Size = DataSize;
-            Header->PropertiesOffset = PropertiesOffset;
-            Header->NumViewModels = NumViewModels;
-            Header->NumProperties = NumProperties;
+            if (bWide)
+            {
+                FWideHeader* WideHeader = (FWideHeader*)Data;
+                WideHeader->Size = (int32)DataSize;
+                WideHeader->PropertiesOffset = (int32)PropertiesOffset;
+                WideHeader->NumViewModels = NumViewModels;
+                WideHeader->NumProperties = NumProperties;
+
+                Header->Size = 0;
+                Header->PropertiesOffset = 0;
+                Header->NumViewModels = 0;
+                Header->NumProperties = 0;
+            }
+            else
+            {
+                Header->Size = (int16)DataSize;
+                Header->PropertiesOffset = (int16)PropertiesOffset;
+                Header->NumViewModels = (uint8)NumViewModels;
+                Header->NumProperties = (uint8)NumProperties;
+            }
+
+            Header->bWide = bWide;
             Header->bHasSubscription = false;
+            Header->bDiffRebind = false;
+            Header->bDiffPropagation = false;
         }
 
         FBindingConfiguration& operator= (const FBindingConfiguration& Other)
@@ -171,10 +222,10 @@ namespace UnrealMvvm_Impl
             {
                 checkSlow(VerifyEmptyHandlers(Other));
 
-                const FHeader* Header = (const FHeader*)Other.Data;
+                const int32 Size = Other.GetSize();
 
-                Data = (uint8*)FMemory::Malloc(Header->Size);
-                FMemory::Memcpy(Data, Other.Data, Header->Size);
+                Data = (uint8*)FMemory::Malloc(Size);
+                FMemory::Memcpy(Data, Other.Data, Size);
             }
             else
             {
@@ -210,7 +261,7 @@ namespace UnrealMvvm_Impl
         {
             if (Data != nullptr)
             {
-                return MakeArrayView((FResolvedViewModelEntry*)(Data + ViewModelsOffset), GetHeader()->NumViewModels);
+                return MakeArrayView((FResolvedViewModelEntry*)(Data + GetViewModelsOffset()), GetNumViewModels());
             }
             return {};
         }
@@ -219,7 +270,7 @@ namespace UnrealMvvm_Impl
         {
             if (Data != nullptr)
             {
-                return MakeArrayView((FResolvedPropertyEntry*)(Data + GetHeader()->PropertiesOffset), GetHeader()->NumProperties);
+                return MakeArrayView((FResolvedPropertyEntry*)(Data + GetPropertiesOffset()), GetNumProperties());
             }
             return {};
         }
@@ -228,7 +279,7 @@ namespace UnrealMvvm_Impl
         {
             if (Data != nullptr)
             {
-                return MakeArrayView((FResolvedPropertyEntry*)(Data + GetHeader()->PropertiesOffset) + ViewModelEntry.FirstProperty, ViewModelEntry.NumProperties);
+                return MakeArrayView((FResolvedPropertyEntry*)(Data + GetPropertiesOffset()) + ViewModelEntry.FirstProperty, ViewModelEntry.NumProperties);
             }
             return {};
         }
@@ -243,6 +294,44 @@ namespace UnrealMvvm_Impl
             return (const FHeader*)Data;
         }
 
+        /* Returns whether this configuration uses wide header. Valid only if Data is not null */
+        bool IsWide() const
+        {
+            return GetHeader()->bWide;
+        }
+
+        int32 GetSize() const
+        {
+            return IsWide() ? GetWideHeader()->Size : GetHeader()->Size;
+        }
+
+        int32 GetViewModelsOffset() const
+        {
+            return IsWide() ? WideViewModelsOffset : ViewModelsOffset;
+        }
+
+        int32 GetPropertiesOffset() const
+        {
+            return IsWide() ? GetWideHeader()->PropertiesOffset : GetHeader()->PropertiesOffset;
+        }
+
+        int32 GetNumViewModels() const
+        {
+            return IsWide() ? GetWideHeader()->NumViewModels : GetHeader()->NumViewModels;
+        }
+
+        int32 GetNumProperties() const
+        {
+            return IsWide() ? GetWideHeader()->NumProperties : GetHeader()->NumProperties;
+        }
+
+        /* Returns whether configuration of given size can use compact header */
+        static bool FitsCompactHeader(int32 NumViewModels, int32 NumProperties)
+        {
+            const int64 DataSize = ViewModelsOffset + (int64)sizeof(FResolvedViewModelEntry) * NumViewModels + (int64)sizeof(FResolvedPropertyEntry) * NumProperties;
+            return NumViewModels <= MAX_uint8 && NumProperties <= MAX_uint8 && DataSize <= MAX_int16;
+        }
+
         bool HasSubscription() const
         {
             return Data != nullptr ? GetHeader()->bHasSubscription : false;
@@ -256,10 +345,57 @@ namespace UnrealMvvm_Impl
             }
         }
 
+        bool IsDiffRebind() const
+        {
+            return Data != nullptr ? GetHeader()->bDiffRebind : false;
+        }
+
+        void SetDiffRebind(bool bValue)
+        {
+            if (Data == nullptr && bValue)
+            {
+                // flag may be set before Worker is initialized or when View has no bindings, header alone keeps it
+                *this = FBindingConfiguration(0, 0);
+            }
+
+            if (Data)
+            {
+                GetHeader()->bDiffRebind = bValue;
+            }
+        }
+
+        bool IsDiffPropagation() const
+        {
+            return Data != nullptr ? GetHeader()->bDiffPropagation : false;
+        }
+
+        void SetDiffPropagation(bool bValue)
+        {
+            if (Data == nullptr && bValue)
+            {
+                *this = FBindingConfiguration(0, 0);
+            }
+
+            if (Data)
+            {
+                GetHeader()->bDiffPropagation = bValue;
+            }
+        }
+
         static constexpr int32 ViewModelsOffset = 8;
+        static_assert(sizeof(FHeader) <= ViewModelsOffset, "Header does not fit before ViewModel entries");
+
+        static constexpr int32 WideViewModelsOffset = 24;
+        static_assert(sizeof(FWideHeader) <= WideViewModelsOffset, "Wide Header does not fit before ViewModel entries");
+
         uint8* Data;
 
     private:
+        const FWideHeader* GetWideHeader() const
+        {
+            return (const FWideHeader*)Data;
+        }
+
         bool VerifyEmptyHandlers(const FBindingConfiguration& Other)
         {
             TArrayView<FResolvedPropertyEntry> PropertyEntries = const_cast<FBindingConfiguration&>(Other).GetProperties();
@@ -24,14 +24,21 @@ namespace UnrealMvvm_Impl
         void AddBinding(TArrayView<const FName> PropertyPath);
         void AddBinding(TArrayView<const FViewModelPropertyReflection*> PropertyPath);
 
-        FBindingConfiguration Build();
+        /*
+         * Packs added bindings into configuration.
+         * If OutHandlerSlots is provided, it receives index of property entry for each AddBinding call in order of calls,
+         * or INDEX_NONE if binding was ignored.
+         * If OutParentProperties is provided, it receives for each property entry index of property entry that leads to its ViewModel,
+         * or INDEX_NONE for properties of Main ViewModel
+         */
+        FBindingConfiguration Build(TArray<int32>* OutHandlerSlots = nullptr, TArray<int32>* OutParentProperties = nullptr);
 
     private:
         struct FBindingTreeNode
         {
             UClass* ViewModelClass;
             const FViewModelPropertyBase* Property;
-            bool bHandlerExpected = false;
+            int32 BindingIndex = INDEX_NONE;
 
             TArray<FBindingTreeNode> Children;
 
@@ -42,6 +49,7 @@ namespace UnrealMvvm_Impl
         };
 
         FBindingTreeNode Root;
+        int32 NumBindings = 0;
     };
 
 }
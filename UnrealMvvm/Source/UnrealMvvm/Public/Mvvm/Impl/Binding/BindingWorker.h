@@ -13,6 +13,43 @@ namespace UnrealMvvm_Impl
         using ThisClass = FBindingWorker;
 
     public:
+        /*
+         * While alive, makes AddBindingHandler of given Worker put handlers into precomputed property entries instead of searching for them.
+         * Handlers are expected in the same order as bindings were added into FBindingConfigurationBuilder.
+         * Slots of skipped handlers are passed over, handlers that match no remaining slot fall back to search
+         */
+        class FHandlerSlotsScope
+        {
+        public:
+            UE_NONCOPYABLE(FHandlerSlotsScope);
+
+            /* Slots and ParentProperties are produced by FBindingConfigurationBuilder::Build */
+            FHandlerSlotsScope(FBindingWorker& InWorker, TArrayView<const int32> InSlots, TArrayView<const int32> InParentProperties)
+                : Worker(&InWorker)
+                , Slots(InSlots)
+                , ParentProperties(InParentProperties)
+                , Previous(Current)
+            {
+                Current = this;
+            }
+
+            ~FHandlerSlotsScope()
+            {
+                Current = Previous;
+            }
+
+        private:
+            friend class FBindingWorker;
+
+            FBindingWorker* Worker;
+            TArrayView<const int32> Slots;
+            TArrayView<const int32> ParentProperties;
+            int32 NextSlot = 0;
+            FHandlerSlotsScope* Previous;
+
+            static FHandlerSlotsScope* Current;
+        };
+
         ~FBindingWorker()
         {
             StopListening();
@@ -23,12 +60,24 @@ namespace UnrealMvvm_Impl
         template<typename THandler, typename... TArgs>
         THandler& AddBindingHandler(TArrayView<const FViewModelPropertyBase* const> PropertyPath, TArgs&&... Args)
         {
+            if (FResolvedPropertyEntry* PropertyEntry = TakeHandlerSlot(PropertyPath))
+            {
+                PropertyEntry->EmplaceHandler<THandler>(Forward<TArgs>(Args)...);
+                return *(THandler*)PropertyEntry->GetHandler();
+            }
+
             return AddBindingHandlerImpl<const FViewModelPropertyBase* const, THandler, TArgs...>(PropertyPath, Forward<TArgs>(Args)...);
         }
 
         template<typename THandler, typename... TArgs>
         THandler& AddBindingHandler(TArrayView<const FName> PropertyPath, TArgs&&... Args)
         {
+            if (FResolvedPropertyEntry* PropertyEntry = TakeHandlerSlot(PropertyPath))
+            {
+                PropertyEntry->EmplaceHandler<THandler>(Forward<TArgs>(Args)...);
+                return *(THandler*)PropertyEntry->GetHandler();
+            }
+
             return AddBindingHandlerImpl<const FName, THandler, TArgs...>(PropertyPath, Forward<TArgs>(Args)...);
         }
 
@@ -57,16 +106,128 @@ namespace UnrealMvvm_Impl
 
         void StopListening();
 
+        /*
+         * Replaces Main ViewModel while listening to changes.
+         * Only handlers whose values differ between old and new ViewModels are invoked,
+         * only ViewModels that differ are resubscribed
+         */
+        void RebindViewModel(UBaseViewModel* InViewModel);
+
+        /* Returns whether ViewModel changes should go through RebindViewModel */
+        bool IsDiffRebindEnabled() const
+        {
+            return Bindings.IsDiffRebind();
+        }
+
+        void SetDiffRebindEnabled(bool bEnabled)
+        {
+            Bindings.SetDiffRebind(bEnabled);
+        }
+
+        /* Returns whether handlers are skipped when ViewModel in the middle of Path is replaced with one having equal values */
+        bool IsDiffPropagationEnabled() const
+        {
+            return Bindings.IsDiffPropagation();
+        }
+
+        void SetDiffPropagationEnabled(bool bEnabled)
+        {
+            Bindings.SetDiffPropagation(bEnabled);
+        }
+
+        /*
+         * Invokes text bindings (Bind to SetText, including numeric formatting) of all listening Workers again, e.g. after culture change.
+         * Other bindings are not invoked. Workers are processed in batches spread across frames,
+         * each frame spends at most MaxSecondsPerFrame, but processes at least one Worker. Zero means everything is processed immediately.
+         * Bindings of struct ViewModels are not tracked by Workers, call TStructViewModelBinding::Refresh for them
+         */
+        static void RefreshTextBindings(double MaxSecondsPerFrame);
+
+        /* Returns whether text bindings refresh started by RefreshTextBindings is still in progress */
+        static bool IsRefreshingTextBindings();
+
+        /* Cancels text bindings refresh in progress and removes its ticker. Called when module is shut down */
+        static void CancelTextBindingsRefresh();
+
     private:
+        static void OnPropertyChanged(void* Owner, UBaseViewModel* ViewModel, const FViewModelPropertyBase* Property)
+        {
+            static_cast<FBindingWorker*>(Owner)->OnPropertyChanged(Property, ViewModel);
+        }
+
         void OnPropertyChanged(const FViewModelPropertyBase* Property, UBaseViewModel* ViewModel);
 
-        void ProcessPropertyChange(UBaseViewModel* ViewModel, const FResolvedPropertyEntry& PropertyEntry);
+        void InvokeTextHandlers();
+
+        /* Processes pending text refresh until time budget is exhausted. Returns true if there is more work left */
+        static bool ProcessTextBindingsRefresh(double MaxSeconds);
+
+        /* PreviousViewModel is the one that provided value of this property before, its handler is skipped if values are equal */
+        void ProcessPropertyChange(UBaseViewModel* ViewModel, const FResolvedPropertyEntry& PropertyEntry, UBaseViewModel* PreviousViewModel = nullptr);
+
+        void PropagateChanges(const FResolvedViewModelEntry& ViewModelEntry, UBaseViewModel* PreviousViewModel);
+
+        void Subscribe(FResolvedViewModelEntry& ViewModelEntry)
+        {
+            check(!ViewModelEntry.SubscriptionHandle.IsValid());
+            ViewModelEntry.SubscriptionHandle = ViewModelEntry.ViewModel->Subscribe(this, &ThisClass::OnPropertyChanged);
+        }
+
+        void Unsubscribe(FResolvedViewModelEntry& ViewModelEntry)
+        {
+            if (ViewModelEntry.SubscriptionHandle.IsValid())
+            {
+                ViewModelEntry.ViewModel->Unsubscribe(ViewModelEntry.SubscriptionHandle);
+                ViewModelEntry.SubscriptionHandle.Reset();
+            }
+        }
+
+        template<typename TPathEntry>
+        FResolvedPropertyEntry* TakeHandlerSlot(TArrayView<TPathEntry> PropertyPath)
+        {
+            FHandlerSlotsScope* Scope = FHandlerSlotsScope::Current;
+            if (Scope == nullptr || Scope->Worker != this)
+            {
+                return nullptr;
+            }
+
+            TArrayView<FResolvedPropertyEntry> PropertyEntries = Bindings.GetProperties();
 
-        void PropagateChanges(const FResolvedViewModelEntry& ViewModelEntry);
+            // usually the next slot matches, slots of conditional bindings that were skipped are passed over
+            for (int32 SlotIndex = Scope->NextSlot; SlotIndex < Scope->Slots.Num(); ++SlotIndex)
+            {
+                const int32 Slot = Scope->Slots[SlotIndex];
+
+                // ignored bindings have no slot, taken slots belong to handlers added out of order
+                if (Slot != INDEX_NONE && !PropertyEntries[Slot].bHasHandler && IsEntryOfPath(*Scope, Slot, PropertyPath))
+                {
+                    Scope->NextSlot = SlotIndex + 1;
+                    return &PropertyEntries[Slot];
+                }
+            }
 
-        void Subscribe(UBaseViewModel* ViewModel)
+            // handler added out of order or more handlers than were recorded, let the regular path find its entry
+            return nullptr;
+        }
+
+        /* Returns whether property entry at PropertyIndex is reached by PropertyPath from Main ViewModel */
+        template<typename TPathEntry>
+        bool IsEntryOfPath(const FHandlerSlotsScope& Scope, int32 PropertyIndex, TArrayView<TPathEntry> PropertyPath)
         {
-            ViewModel->Subscribe(UBaseViewModel::FPropertyChangedDelegate::FDelegate::CreateRaw(this, &ThisClass::OnPropertyChanged, ViewModel));
+            TArrayView<FResolvedPropertyEntry> PropertyEntries = Bindings.GetProperties();
+
+            for (int32 Index = PropertyPath.Num() - 1; Index >= 0; --Index)
+            {
+                if (PropertyIndex == INDEX_NONE || !(PropertyEntries[PropertyIndex] == PropertyPath[Index]))
+                {
+                    return false;
+                }
+
+                PropertyIndex = Scope.ParentProperties[PropertyIndex];
+            }
+
+            // path must start at Main ViewModel
+            return PropertyIndex == INDEX_NONE;
         }
 
         template<typename TPathEntry, typename THandler, typename... TArgs>
@@ -115,8 +276,14 @@ namespace UnrealMvvm_Impl
 
         UBaseViewModel* GetViewModelFromProperty(UBaseViewModel* ViewModel, const FViewModelPropertyBase* Property);
 
+        bool HasEqualValues(UBaseViewModel* First, UBaseViewModel* Second, const FViewModelPropertyBase* Property);
+
         UObject* OwningView;
         FBindingConfiguration Bindings;
+
+        // links of intrusive list of listening Workers, so starting and stopping does not touch any container
+        FBindingWorker* PrevListening = nullptr;
+        FBindingWorker* NextListening = nullptr;
     };
 
 }
@@ -3,6 +3,7 @@
 #pragma once
 
 class UBaseViewModel;
+class FBaseStructViewModel;
 class FViewModelPropertyBase;
 
 namespace UnrealMvvm_Impl
@@ -11,5 +12,15 @@ namespace UnrealMvvm_Impl
     {
         virtual ~IPropertyChangeHandler() = default;
         virtual void Invoke(UBaseViewModel* ViewModel, const FViewModelPropertyBase* Property) const = 0;
+
+        /* Returns whether this handler sets text that depends on current culture. See FBindingWorker::RefreshTextBindings */
+        virtual bool IsTextBinding() const { return false; }
+    };
+
+    /* Handler of a binding to ViewModel derived from FBaseStructViewModel. See TStructViewModelBinding */
+    struct IStructPropertyChangeHandler
+    {
+        virtual ~IStructPropertyChangeHandler() = default;
+        virtual void Invoke(FBaseStructViewModel* ViewModel, const FViewModelPropertyBase* Property) const = 0;
     };
 }
@@ -0,0 +1,85 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "CoreGlobals.h"
+#include "Containers/Map.h"
+#include "Internationalization/Text.h"
+#include "Misc/Optional.h"
+#include "Templates/Tuple.h"
+
+namespace UnrealMvvm_Impl
+{
+    /*
+     * Shares results of FText::AsNumber and FText::AsPercent between text bindings that use the same formatting options,
+     * so many Views showing the same value format it only once. Cached texts live until the end of current frame.
+     * Must be used from game thread only
+     */
+    class UNREALMVVM_API FNumberTextCache
+    {
+    public:
+        /* Returns index identifying given formatting options. Call it once when binding is created */
+        static int32 GetFormatIndex(const FNumberFormattingOptions* Options, const FCulturePtr& TargetCulture);
+
+        /* Returns Value formatted with options identified by FormatIndex */
+        template <typename TValue>
+        static FText Format(TValue Value, int32 FormatIndex)
+        {
+            return FormatImpl<false>(Value, FormatIndex);
+        }
+
+        /* Returns Value formatted as percent with options identified by FormatIndex. 1.0 is formatted as 100% */
+        template <typename TValue>
+        static FText FormatPercent(TValue Value, int32 FormatIndex)
+        {
+            return FormatImpl<true>(Value, FormatIndex);
+        }
+
+        /* Drops all cached texts and makes text bindings set their texts again on next invocation. Used when culture is changed */
+        static void Invalidate();
+
+        /* Returns counter incremented by every Invalidate call */
+        static uint32 GetGeneration();
+
+    private:
+        template <bool bPercent, typename TValue>
+        static FText FormatImpl(TValue Value, int32 FormatIndex)
+        {
+            static TMap<TTuple<TValue, int32>, FText> Cache;
+            static uint64 CacheFrame = 0;
+            static uint32 CacheGeneration = 0;
+
+            if (CacheFrame != GFrameCounter || CacheGeneration != GetGeneration())
+            {
+                CacheFrame = GFrameCounter;
+                CacheGeneration = GetGeneration();
+                Cache.Reset();
+            }
+
+            const TTuple<TValue, int32> Key(Value, FormatIndex);
+            if (const FText* Cached = Cache.Find(Key))
+            {
+                return *Cached;
+            }
+
+            const FFormat& Entry = GetFormat(FormatIndex);
+            if constexpr (bPercent)
+            {
+                return Cache.Add(Key, FText::AsPercent(Value, Entry.Options.GetPtrOrNull(), Entry.TargetCulture));
+            }
+            else
+            {
+                return Cache.Add(Key, FText::AsNumber(Value, Entry.Options.GetPtrOrNull(), Entry.TargetCulture));
+            }
+        }
+
+        struct FFormat
+        {
+            TOptional<FNumberFormattingOptions> Options;
+            FCulturePtr TargetCulture;
+        };
+
+        static TArray<FFormat>& GetFormats();
+        static const FFormat& GetFormat(int32 FormatIndex);
+    };
+}
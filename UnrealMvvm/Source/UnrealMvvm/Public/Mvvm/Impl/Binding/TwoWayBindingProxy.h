@@ -0,0 +1,120 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Mvvm/Impl/ListenManager/EventForwardingProxy.h"
+#include "Mvvm/Impl/Property/CanCompareHelper.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+#include "TwoWayBindingProxy.generated.h"
+
+class UBaseViewModel;
+
+namespace UnrealMvvm_Impl
+{
+    /*
+     * Shared state of a two-way binding. Receives values from View event and writes the last one into ViewModel on next frame.
+     * Value is dropped if View gets another ViewModel before it is written, e.g. when list row is reused for another item.
+     * While value is being written, ViewModel to View handler of the same binding skips the echo
+     */
+    class FTwoWayBindingState : public FDynamicEventCoalescerBase
+    {
+    public:
+        FTwoWayBindingState()
+            : FDynamicEventCoalescerBase({ EEventCoalescing::Debounce, 0.f })
+        {
+        }
+
+        /* Returns whether value is being written into ViewModel right now */
+        bool IsWriting() const { return bWriting; }
+
+    protected:
+        bool bWriting = false;
+    };
+
+    template <typename TView, typename TProperty, typename TWidget, typename TSetter, typename TEventValue>
+    class TTwoWayBindingState : public FTwoWayBindingState
+    {
+    public:
+        using FValueType = typename TProperty::FValueType;
+
+        TTwoWayBindingState(TView* InView, const TProperty* InProperty, TWidget* InWidget, TSetter InSetter)
+            : View(InView)
+            , Property(InProperty)
+            , Widget(InWidget)
+            , Setter(InSetter)
+        {
+        }
+
+        void Push(const void* Parms) override
+        {
+            // written value is the first parameter of event
+            PendingValue.Emplace(*(const TEventValue*)Parms);
+            TargetViewModel = View->GetViewModel();
+            Schedule();
+        }
+
+        /* Sets value of ViewModel to widget */
+        void ApplyToWidget(typename TProperty::FGetterReturnType Value) const
+        {
+            if (TWidget* WidgetPtr = Widget.Get())
+            {
+                (WidgetPtr->*Setter)(Value);
+            }
+        }
+
+    protected:
+        void Flush() override
+        {
+            if (PendingValue.IsSet())
+            {
+                FValueType Value = MoveTemp(PendingValue.GetValue());
+                PendingValue.Reset();
+
+                auto* ViewModel = View->GetViewModel();
+                if (ViewModel != nullptr && ViewModel == TargetViewModel.Get())
+                {
+                    {
+                        TGuardValue<bool> WritingGuard(bWriting, true);
+                        Property->SetValue(ViewModel, Value);
+                    }
+
+                    // setter may clamp or normalize value, or keep the old one, widget must show what ViewModel actually has
+                    if constexpr (TCanCompareHelper<FValueType>::Value)
+                    {
+                        if (!AreValuesEqual<FValueType>(Property->GetValue(ViewModel), Value))
+                        {
+                            ApplyToWidget(Property->GetValue(ViewModel));
+                        }
+                    }
+                    else
+                    {
+                        ApplyToWidget(Property->GetValue(ViewModel));
+                    }
+                }
+            }
+        }
+
+    private:
+        TView* View;
+        const TProperty* Property;
+        TWeakObjectPtr<TWidget> Widget;
+        TSetter Setter;
+        TOptional<FValueType> PendingValue;
+
+        // ViewModel that View had when value was received
+        TWeakObjectPtr<UBaseViewModel> TargetViewModel;
+    };
+}
+
+/*
+ * Listens to Dynamic Multicast Delegate of a widget on behalf of two-way binding and passes its parameters to FTwoWayBindingState.
+ * Proxy is rooted until Release is called by the binding handler
+ */
+UCLASS(Transient)
+class UNREALMVVM_API UTwoWayBindingProxy : public UEventForwardingProxy
+{
+    GENERATED_BODY()
+
+public:
+    static UTwoWayBindingProxy* Create(TSharedRef<UnrealMvvm_Impl::FTwoWayBindingState> InState);
+};
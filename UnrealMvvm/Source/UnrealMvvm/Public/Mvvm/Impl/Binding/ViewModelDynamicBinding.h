@@ -16,6 +16,57 @@ public:
 
     UPROPERTY()
     FName FunctionName;
+
+    /* Index of binding passed to FunctionName if Blueprint was compiled with single dispatch event, INDEX_NONE otherwise */
+    UPROPERTY()
+    int32 DispatchIndex = INDEX_NONE;
+
+    /* Event that takes indices of several bindings of FunctionName at once, used during initialization of View. None if Blueprint was compiled without single dispatch event */
+    UPROPERTY()
+    FName BatchFunctionName;
+};
+
+/* How value of ViewModel property is converted before it is written into target property */
+UENUM()
+enum class EPropertyBindingConversion : uint8
+{
+    /* Both properties have the same type, value is copied as is */
+    None,
+
+    /* Value is bool, target is FBoolProperty */
+    FromBool,
+
+    /* Value is a number of given type, target is FNumericProperty */
+    FromByte,
+    FromInt,
+    FromInt64,
+    FromFloat,
+    FromDouble,
+
+    /* Value is bool, target is ESlateVisibility property. See MvvmConverters::ToVisibility */
+    BoolToVisibility,
+
+    /* Value is float or double, target is FTextProperty. See MvvmConverters::ToPercentText */
+    FloatToPercentText,
+    DoubleToPercentText,
+};
+
+/* Binding that writes value of ViewModel property directly into property of View, without calling Blueprint functions */
+USTRUCT()
+struct FPropertyBindingEntry
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    TArray<FName> PropertyPath;
+
+    /* Path to target property starting from View. All entries except the last one are object properties, e.g. widget variables */
+    UPROPERTY()
+    TArray<FName> TargetPath;
+
+    UPROPERTY()
+    EPropertyBindingConversion Conversion = EPropertyBindingConversion::None;
 };
 
 UCLASS()
@@ -31,4 +82,7 @@ public:
 
     UPROPERTY()
     TArray<FBlueprintBindingEntry> BlueprintBindings;
+
+    UPROPERTY()
+    TArray<FPropertyBindingEntry> PropertyBindings;
 };
@@ -0,0 +1,159 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Templates/UnrealTemplate.h"
+
+class UBaseViewModel;
+class FViewModelPropertyBase;
+
+namespace UnrealMvvm_Impl
+{
+
+    /*
+     * Handle of a subscription to ViewModel changes. Allows to unsubscribe in O(1).
+     * Generation tells apart subscribers that reuse the same Index, so stale handle never removes another subscriber
+     */
+    struct FViewModelSubscriptionHandle
+    {
+        bool IsValid() const
+        {
+            return Index != INDEX_NONE;
+        }
+
+        void Reset()
+        {
+            Index = INDEX_NONE;
+            Generation = 0;
+        }
+
+        int32 Index = INDEX_NONE;
+        uint32 Generation = 0;
+    };
+
+    /*
+     * Intrusive list of ViewModel subscribers.
+     * Each subscriber is a pair of Owner pointer and plain function pointer, so adding one does not allocate delegate instance.
+     * First subscriber is stored inline. Removed subscribers leave holes which are reused later, so handles of other subscribers remain valid.
+     * Holes are not reused during Broadcast, so subscribers added by callbacks are not notified by the same Broadcast
+     */
+    template <typename TViewModel>
+    class TViewModelSubscribers
+    {
+    public:
+        using FCallbackPtr = void (*)(void* Owner, TViewModel* ViewModel, const FViewModelPropertyBase* Property);
+
+        FViewModelSubscriptionHandle Add(void* Owner, FCallbackPtr Callback)
+        {
+            check(Owner);
+            check(Callback);
+
+            int32 Index = INDEX_NONE;
+            if (NumSubscribers < Entries.Num() && BroadcastDepth == 0)
+            {
+                // reuse a hole left by removed subscriber
+                Index = Entries.IndexOfByPredicate([](const FEntry& Entry) { return Entry.Callback == nullptr; });
+            }
+
+            if (Index == INDEX_NONE)
+            {
+                Index = Entries.AddDefaulted();
+            }
+
+            // zero is never used, so default constructed handle does not match any subscriber
+            if (++NextGeneration == 0)
+            {
+                ++NextGeneration;
+            }
+
+            Entries[Index] = FEntry{ Owner, Callback, NextGeneration };
+            NumSubscribers++;
+
+            return FViewModelSubscriptionHandle{ Index, NextGeneration };
+        }
+
+        /* Removes subscriber by Handle. Returns false if subscriber was already removed, e.g. by RemoveAll */
+        bool Remove(FViewModelSubscriptionHandle Handle)
+        {
+            if (!Entries.IsValidIndex(Handle.Index) || Entries[Handle.Index].Callback == nullptr || Entries[Handle.Index].Generation != Handle.Generation)
+            {
+                return false;
+            }
+
+            Entries[Handle.Index] = FEntry();
+            RemoveHoles(1);
+            return true;
+        }
+
+        /* Removes all subscribers with given Owner. Returns number of removed subscribers */
+        int32 RemoveAll(const void* Owner)
+        {
+            int32 NumRemoved = 0;
+
+            for (FEntry& Entry : Entries)
+            {
+                if (Entry.Callback != nullptr && Entry.Owner == Owner)
+                {
+                    Entry = FEntry();
+                    NumRemoved++;
+                }
+            }
+
+            RemoveHoles(NumRemoved);
+            return NumRemoved;
+        }
+
+        void Broadcast(TViewModel* ViewModel, const FViewModelPropertyBase* Property) const
+        {
+            // subscribers added during broadcast are not notified, removed ones are skipped
+            TGuardValue<int32> DepthGuard(BroadcastDepth, BroadcastDepth + 1);
+
+            const int32 NumEntries = Entries.Num();
+            for (int32 Index = 0; Index < NumEntries && Index < Entries.Num(); ++Index)
+            {
+                // copy entry, because callback may modify the list
+                const FEntry Entry = Entries[Index];
+                if (Entry.Callback != nullptr)
+                {
+                    Entry.Callback(Entry.Owner, ViewModel, Property);
+                }
+            }
+        }
+
+        int32 Num() const
+        {
+            return NumSubscribers;
+        }
+
+    private:
+        struct FEntry
+        {
+            void* Owner = nullptr;
+            FCallbackPtr Callback = nullptr;
+            uint32 Generation = 0;
+        };
+
+        void RemoveHoles(int32 NumRemoved)
+        {
+            NumSubscribers -= NumRemoved;
+            check(NumSubscribers >= 0);
+
+            if (NumSubscribers == 0 && BroadcastDepth == 0)
+            {
+                // keeps allocated memory
+                Entries.Reset();
+            }
+        }
+
+        TArray<FEntry, TInlineAllocator<1>> Entries;
+        int32 NumSubscribers = 0;
+        uint32 NextGeneration = 0;
+
+        // number of Broadcast calls in progress, callbacks may raise changes again
+        mutable int32 BroadcastDepth = 0;
+    };
+
+    using FViewModelSubscribers = TViewModelSubscribers<UBaseViewModel>;
+
+}
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "Mvvm/Impl/ListenManager/EventCoalescer.h"
 #include <functional>
 
 class FListenManager;
@@ -25,9 +26,16 @@ namespace UnrealMvvm_Impl
             return std::mem_fn(Event)(Widget);
         }
 
+        void SetCoalescing(EEventCoalescing Mode, float Interval)
+        {
+            Coalescing.Mode = Mode;
+            Coalescing.Interval = FMath::Max(Interval, 0.f);
+        }
+
         FListenManager* Manager;
         TWidget* Widget;
         TEventPtr Event;
+        FEventCoalescingOptions Coalescing;
     };
 
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Mvvm/Impl/ListenManager/BaseEventListenHelper.h"
+#include "Mvvm/Impl/ListenManager/EventCoalescingProxy.h"
 #include "Mvvm/Impl/Utils/PointerToMember.h"
 #include "Misc/EngineVersionComparison.h"
 
@@ -13,6 +14,20 @@ namespace UnrealMvvm_Impl
     class TDynamicEventListenHelper : public TBaseEventListenHelper<TWidget, TEventPtr>
     {
     public:
+        /* Invokes callback on the first event, then at most once per given interval with arguments of the last event. Zero interval means once per frame */
+        TDynamicEventListenHelper& Throttle(float IntervalSeconds = 0.f)
+        {
+            this->SetCoalescing(EEventCoalescing::Throttle, IntervalSeconds);
+            return *this;
+        }
+
+        /* Invokes callback with arguments of the last event once no events arrived during given interval */
+        TDynamicEventListenHelper& Debounce(float IntervalSeconds)
+        {
+            this->SetCoalescing(EEventCoalescing::Debounce, IntervalSeconds);
+            return *this;
+        }
+
         /* Do not use directly. Use 'WithDynamic' macro */
         template<typename TListener>
 #if UE_VERSION_OLDER_THAN(5,8,0)
@@ -24,10 +39,25 @@ namespace UnrealMvvm_Impl
             if (this->Widget != nullptr)
             {
                 auto& EventRef = this->GetEvent();
+
+                if (this->Coalescing.Mode != EEventCoalescing::None)
+                {
+                    // UFunction cannot be wrapped, so event is bound to a proxy object that stores parameters and invokes UFunction later
+                    UEventCoalescingProxy* Proxy = UEventCoalescingProxy::Create(Listener, FunctionName, this->Coalescing);
+
+                    FScriptDelegate Delegate;
+                    Delegate.BindUFunction(Proxy, UEventCoalescingProxy::GetForwardFunctionName());
+                    EventRef.Add(Delegate);
+
+                    using ProxySubscriptionType = typename FListenManager::TProxyUnsubscriber<TWidget, TEventPtr>;
+                    this->Manager->template AddSubscription<ProxySubscriptionType>(&EventRef, Listener, false, this->Widget, this->Event, Proxy);
+                    return;
+                }
+
                 EventRef.__Internal_AddDynamic(Listener, Callback, FunctionName);
 
                 using SubscriptionType = typename FListenManager::TObjectUnsubscriber<TWidget, TEventPtr>;
-                this->Manager->template AddSubscription<SubscriptionType>(this->Widget, this->Event, Listener);
+                this->Manager->template AddSubscription<SubscriptionType>(&EventRef, Listener, true, this->Widget, this->Event, Listener);
             }
         }
 
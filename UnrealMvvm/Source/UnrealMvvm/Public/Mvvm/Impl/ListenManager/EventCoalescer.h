@@ -0,0 +1,155 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Ticker.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Optional.h"
+#include "Templates/SharedPointer.h"
+#include "Templates/Tuple.h"
+#include <type_traits>
+
+namespace UnrealMvvm_Impl
+{
+    enum class EEventCoalescing : uint8
+    {
+        None,
+        Throttle,   // first event is invoked immediately, following ones are suppressed until interval ends and the last of them is invoked then
+        Debounce,   // single invocation after events stop arriving for interval
+    };
+
+    struct FEventCoalescingOptions
+    {
+        EEventCoalescing Mode = EEventCoalescing::None;
+        float Interval = 0.f;
+    };
+
+    /*
+     * Postpones invocation of event handler until next frame or end of interval. Throttle invokes the first event right away.
+     * Derived classes keep arguments of the last event and invoke handler in Flush
+     */
+    class FEventCoalescerBase : public TSharedFromThis<FEventCoalescerBase>
+    {
+    public:
+        UE_NONCOPYABLE(FEventCoalescerBase);
+
+        explicit FEventCoalescerBase(const FEventCoalescingOptions& InOptions)
+            : Options(InOptions)
+        {
+        }
+
+        virtual ~FEventCoalescerBase()
+        {
+            if (TickerHandle.IsValid())
+            {
+                FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+            }
+        }
+
+    protected:
+        /* Call it after arguments of new event are stored */
+        void Schedule()
+        {
+            const double Now = FPlatformTime::Seconds();
+
+            if (Options.Mode == EEventCoalescing::Throttle)
+            {
+                if (TickerHandle.IsValid())
+                {
+                    // interval is not over yet, the last suppressed event is invoked when it ends
+                    bFlushOnDue = true;
+                }
+                else
+                {
+                    // interval is opened before invocation, so events raised by handler are suppressed too
+                    DueTime = Now + Options.Interval;
+                    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FEventCoalescerBase::Tick));
+
+                    // handler may unsubscribe and release this coalescer
+                    TSharedRef<FEventCoalescerBase> KeepAlive = AsShared();
+                    Flush();
+                }
+            }
+            else if (!TickerHandle.IsValid())
+            {
+                DueTime = Now + Options.Interval;
+                TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FEventCoalescerBase::Tick));
+            }
+            else if (Options.Mode == EEventCoalescing::Debounce)
+            {
+                DueTime = Now + Options.Interval;
+            }
+        }
+
+        virtual void Flush() = 0;
+
+    private:
+        bool Tick(float DeltaTime)
+        {
+            if (FPlatformTime::Seconds() < DueTime)
+            {
+                return true;
+            }
+
+            if (bFlushOnDue)
+            {
+                // suppressed event is invoked at the end of interval and opens the next one
+                bFlushOnDue = false;
+                DueTime = FPlatformTime::Seconds() + Options.Interval;
+                Flush();
+                return true;
+            }
+
+            // handler may raise the same event again, it must schedule new invocation
+            TickerHandle.Reset();
+            Flush();
+            return false;
+        }
+
+        FEventCoalescingOptions Options;
+        FTSTicker::FDelegateHandle TickerHandle;
+        double DueTime = 0.0;
+        bool bFlushOnDue = false;
+    };
+
+    // deduces tuple of decayed argument types from signature of Execute method of a delegate
+    template <typename TRet, typename TClass, typename... TArgs>
+    TTuple<std::decay_t<TArgs>...> DeduceDelegateArgs(TRet (TClass::*)(TArgs...) const);
+
+    /* Coalesces invocations of Non-Dynamic delegate */
+    template <typename TDelegate>
+    class TSimpleEventCoalescer : public FEventCoalescerBase
+    {
+    public:
+        TSimpleEventCoalescer(const FEventCoalescingOptions& InOptions, TDelegate&& InHandler)
+            : FEventCoalescerBase(InOptions)
+            , Handler(MoveTemp(InHandler))
+        {
+        }
+
+        template <typename... TArgs>
+        void Push(TArgs&&... Args)
+        {
+            LastArgs.Emplace(Forward<TArgs>(Args)...);
+            Schedule();
+        }
+
+    protected:
+        void Flush() override
+        {
+            if (LastArgs.IsSet())
+            {
+                FArgs Args = MoveTemp(LastArgs.GetValue());
+                LastArgs.Reset();
+
+                Args.ApplyAfter([this](auto&... Values) { Handler.ExecuteIfBound(Values...); });
+            }
+        }
+
+    private:
+        using FArgs = decltype(DeduceDelegateArgs(&TDelegate::Execute));
+
+        TDelegate Handler;
+        TOptional<FArgs> LastArgs;
+    };
+}
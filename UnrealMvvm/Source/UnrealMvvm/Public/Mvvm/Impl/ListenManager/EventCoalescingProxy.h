@@ -0,0 +1,19 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Mvvm/Impl/ListenManager/EventForwardingProxy.h"
+#include "EventCoalescingProxy.generated.h"
+
+/*
+ * Listens to Dynamic Multicast Delegate on behalf of Listener and forwards coalesced invocations to its UFunction.
+ * Proxy is rooted until Release is called by FListenManager
+ */
+UCLASS(Transient)
+class UNREALMVVM_API UEventCoalescingProxy : public UEventForwardingProxy
+{
+    GENERATED_BODY()
+
+public:
+    static UEventCoalescingProxy* Create(UObject* Listener, FName FunctionName, const UnrealMvvm_Impl::FEventCoalescingOptions& Options);
+};
@@ -0,0 +1,50 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "UObject/Object.h"
+#include "Mvvm/Impl/ListenManager/EventCoalescer.h"
+#include "EventForwardingProxy.generated.h"
+
+namespace UnrealMvvm_Impl
+{
+    /* Coalescer that receives raw parameters of Dynamic event intercepted by UEventForwardingProxy */
+    class FDynamicEventCoalescerBase : public FEventCoalescerBase
+    {
+    public:
+        using FEventCoalescerBase::FEventCoalescerBase;
+
+        /* Stores parameters of event */
+        virtual void Push(const void* Parms) = 0;
+    };
+}
+
+/*
+ * Listens to Dynamic Multicast Delegate and passes its parameters to a coalescer.
+ * Proxy is rooted from Start until Release is called by its owner
+ */
+UCLASS(Abstract, Transient)
+class UNREALMVVM_API UEventForwardingProxy : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /* Drops pending invocation and allows proxy to be garbage collected */
+    void Release();
+
+    /* Name of function to bind event to */
+    static FName GetForwardFunctionName() { return GET_FUNCTION_NAME_CHECKED(UEventForwardingProxy, Forward); }
+
+    void ProcessEvent(UFunction* Function, void* Parms) override;
+
+protected:
+    /* Called by Create methods of derived classes */
+    void Start(TSharedRef<UnrealMvvm_Impl::FDynamicEventCoalescerBase> InCoalescer);
+
+    TSharedPtr<UnrealMvvm_Impl::FDynamicEventCoalescerBase> Coalescer;
+
+private:
+    /* Never executed, parameters of event are intercepted in ProcessEvent */
+    UFUNCTION()
+    void Forward() {}
+};
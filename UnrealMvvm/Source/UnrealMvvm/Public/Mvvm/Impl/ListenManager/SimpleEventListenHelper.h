@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Mvvm/Impl/ListenManager/BaseEventListenHelper.h"
+#include "Mvvm/Impl/Utils/PointerToMember.h"
 
 namespace UnrealMvvm_Impl
 {
@@ -11,12 +12,26 @@ namespace UnrealMvvm_Impl
     class TSimpleEventListenHelper : public TBaseEventListenHelper<TWidget, TEventPtr>
     {
     public:
+        /* Invokes callback on the first event, then at most once per given interval with arguments of the last event. Zero interval means once per frame */
+        TSimpleEventListenHelper& Throttle(float IntervalSeconds = 0.f)
+        {
+            this->SetCoalescing(EEventCoalescing::Throttle, IntervalSeconds);
+            return *this;
+        }
+
+        /* Invokes callback with arguments of the last event once no events arrived during given interval */
+        TSimpleEventListenHelper& Debounce(float IntervalSeconds)
+        {
+            this->SetCoalescing(EEventCoalescing::Debounce, IntervalSeconds);
+            return *this;
+        }
+
         template<typename TCallback>
         void WithStatic(TCallback&& Callback)
         {
             if (this->Widget != nullptr)
             {
-                AddSubscription(this->GetEvent().AddStatic(MoveTemp(Callback)));
+                AddDelegate(FDelegate::CreateStatic(MoveTemp(Callback)), nullptr);
             }
         }
 
@@ -25,7 +40,7 @@ namespace UnrealMvvm_Impl
         {
             if (this->Widget != nullptr)
             {
-                AddSubscription(this->GetEvent().AddLambda(MoveTemp(Callback)));
+                AddDelegate(FDelegate::CreateLambda(MoveTemp(Callback)), nullptr);
             }
         }
 
@@ -34,7 +49,7 @@ namespace UnrealMvvm_Impl
         {
             if (this->Widget != nullptr)
             {
-                AddSubscription(this->GetEvent().AddWeakLambda(Obj, MoveTemp(Callback)));
+                AddDelegate(FDelegate::CreateWeakLambda(Obj, MoveTemp(Callback)), Obj);
             }
         }
 
@@ -43,7 +58,7 @@ namespace UnrealMvvm_Impl
         {
             if (this->Widget != nullptr)
             {
-                AddSubscription(this->GetEvent().AddSP(Listener, Callback));
+                AddDelegate(FDelegate::CreateSP(Listener, Callback), Listener);
             }
         }
 
@@ -52,7 +67,7 @@ namespace UnrealMvvm_Impl
         {
             if (this->Widget != nullptr)
             {
-                AddSubscription(this->GetEvent().AddUObject(Listener, Callback));
+                AddDelegate(FDelegate::CreateUObject(Listener, Callback), Listener);
             }
         }
 
@@ -64,10 +79,25 @@ namespace UnrealMvvm_Impl
         {
         }
 
-        void AddSubscription(const FDelegateHandle& Handle)
+        using FDelegate = typename TDecay<typename TPointerToMember<TEventPtr>::ValueType>::Type::FDelegate;
+
+        void AddDelegate(FDelegate&& Delegate, const void* Subscriber)
+        {
+            if (this->Coalescing.Mode == EEventCoalescing::None)
+            {
+                AddSubscription(this->GetEvent().Add(MoveTemp(Delegate)), Subscriber, true);
+                return;
+            }
+
+            // coalescer is owned by subscription and is destroyed together with it
+            TSharedRef<TSimpleEventCoalescer<FDelegate>> Coalescer = MakeShared<TSimpleEventCoalescer<FDelegate>>(this->Coalescing, MoveTemp(Delegate));
+            AddSubscription(this->GetEvent().AddLambda([Coalescer](auto&&... Args) { Coalescer->Push(Args...); }), Subscriber, false);
+        }
+
+        void AddSubscription(const FDelegateHandle& Handle, const void* Subscriber, bool bBoundToSubscriber)
         {
             using SubscriptionType = FListenManager::THandleUnsubscriber<TWidget, TEventPtr>;
-            this->Manager->template AddSubscription<SubscriptionType>(this->Widget, this->Event, Handle);
+            this->Manager->template AddSubscription<SubscriptionType>(&this->GetEvent(), Subscriber, bBoundToSubscriber, this->Widget, this->Event, Handle);
         }
     };
 
@@ -4,6 +4,8 @@
 
 #include "Templates/Models.h"
 #include "UObject/Class.h"
+#include "Mvvm/ViewModelPropertyTypeTraits.h"
+#include "Mvvm/Impl/Property/PropertyTypeSelector.h"
 
 namespace UnrealMvvm_Impl
 {
@@ -40,4 +42,45 @@ namespace UnrealMvvm_Impl
     CAN_COMPARE_SPECIALIZE_CONTAINER(TOptional);
 
 #undef CAN_COMPARE_SPECIALIZE_CONTAINER
+
+    /* Compares two values using Identical method if type has it, or operator== otherwise. Type must satisfy TCanCompareHelper */
+    template <typename T>
+    bool AreValuesEqual(const T& A, const T& B)
+    {
+        if constexpr (TStructOpsTypeTraits<T>::WithIdentical)
+        {
+            return A.Identical(&B, 0);
+        }
+        else
+        {
+            return A == B;
+        }
+    }
+
+    /*
+     * Sets new value to provided variable.
+     * Optionaly performs comparison of current value and new value.
+     * Returns true if value was changed
+     */
+    template <typename TValue>
+    bool TrySetValue(TValue& Field, typename TPropertyTypeSelector<TValue>::SetterType InValue)
+    {
+        // check if we need to compare values
+        if constexpr (TViewModelPropertyTypeTraits<TValue>::WithSetterComparison && TCanCompareHelper<TValue>::Value)
+        {
+            // compare using Identical method or operator ==
+            if (!AreValuesEqual<TValue>(Field, InValue))
+            {
+                Field = InValue;
+                return true;
+            }
+            return false;
+        }
+        else
+        {
+            // no comparison needed, just set the value
+            Field = InValue;
+            return true;
+        }
+    }
 }
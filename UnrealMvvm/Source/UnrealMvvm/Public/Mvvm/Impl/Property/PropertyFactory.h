@@ -5,26 +5,69 @@
 #include "Runtime/Launch/Resources/Version.h"
 #include "Misc/EngineVersionComparison.h"
 #include "UObject/TextProperty.h"
+#include "UObject/EnumProperty.h"
 #include "UObject/GarbageCollection.h"
 #include "Mvvm/Impl/Property/ValueTypeTraits.h"
+#include "Mvvm/Impl/Utils/TryGetStaticEnum.h"
 
 namespace UnrealMvvm_Impl
 {
 
     namespace Details
     {
+        /* Returns whether values of ValueClass may be stored in Property */
+        inline bool IsPropertyOfClass(const FObjectPropertyBase* Property, UClass* ValueClass)
+        {
+            return Property && ValueClass->IsChildOf(Property->PropertyClass);
+        }
+
+        inline bool IsPropertyOfClass(const FSoftClassProperty* Property, UClass* ValueClass)
+        {
+            return Property && ValueClass->IsChildOf(Property->MetaClass);
+        }
+
+        inline bool IsPropertyOfClass(const FInterfaceProperty* Property, UClass* ValueClass)
+        {
+            return Property && ValueClass->IsChildOf(Property->InterfaceClass);
+        }
+
         /*
          * This class creates FProperty objects based on requested TValue
+         * ContainsObjectReference tells whether TValue may contain object references,
+         * HasObjectReference refines it in runtime using reflection data.
+         * IsSameType tells whether existing FProperty holds values of TValue, so they can be copied into it as is
          */
         template <typename TValue, typename = void>
         struct TPropertyFactory
         {
             static constexpr bool IsSupportedByUnreal = false;
             static constexpr bool ContainsObjectReference = false;
+            static bool HasObjectReference() { return ContainsObjectReference; }
 
             static void AddProperty(FFieldVariant Scope, uint16 FieldOffset, const FName& DebugName)
             {
             }
+
+            static bool IsSameType(const FProperty* Property)
+            {
+                // UEnum properties are not created by us, but values of the same enum may be copied
+                if constexpr (TIsEnumClass<TValue>::Value)
+                {
+                    UObject* Enum = TryGetStaticEnum<TValue>();
+
+                    if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+                    {
+                        return Enum != nullptr && EnumProperty->GetEnum() == Enum && EnumProperty->GetElementSize() == sizeof(TValue);
+                    }
+
+                    if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
+                    {
+                        return Enum != nullptr && ByteProperty->Enum == Enum && sizeof(TValue) == sizeof(uint8);
+                    }
+                }
+
+                return false;
+            }
         };
 
 #if UE_VERSION_OLDER_THAN(5,8,0)
@@ -58,28 +101,41 @@ namespace UnrealMvvm_Impl
 #define DECLARE_WRAPPER_PROPERTY_INNER(PropertyType, PropertyGenType, InnerClass) \
     new PropertyType(COMMON_PROPERTY_PARAMS( PropertyGenType, FieldOffset, &InnerClass ));
 
-#define DECLARE_SIMPLE_PROPERTY(VariableType, PropertyType, PropertyGenType) \
+#define DECLARE_SIMPLE_PROPERTY_EX(VariableType, PropertyType, MatchingPropertyType, PropertyGenType) \
         template <> \
         struct TPropertyFactory<VariableType> \
         { \
             static constexpr bool IsSupportedByUnreal = true; \
             static constexpr bool ContainsObjectReference = false; \
+            static bool HasObjectReference() { return ContainsObjectReference; } \
             static void AddProperty(FFieldVariant Scope, uint16 FieldOffset, const FName& DebugName) \
             { \
                 DECLARE_SIMPLE_PROPERTY_INNER(PropertyType, PropertyGenType); \
             } \
+            static bool IsSameType(const FProperty* Property) \
+            { \
+                return Property->IsA<MatchingPropertyType>(); \
+            } \
         }
 
-#define DECLARE_WRAPPER_PROPERTY(VariableType, PropertyType, PropertyGenType, ContainsReference, InnerClass) \
+#define DECLARE_SIMPLE_PROPERTY(VariableType, PropertyType, PropertyGenType) \
+        DECLARE_SIMPLE_PROPERTY_EX(VariableType, PropertyType, PropertyType, PropertyGenType)
+
+#define DECLARE_WRAPPER_PROPERTY(VariableType, PropertyType, PropertyGenType, ContainsReference, InnerClass, ValueClass) \
         template <typename TValue> \
         struct TPropertyFactory<VariableType> \
         { \
             static constexpr bool IsSupportedByUnreal = true; \
             static constexpr bool ContainsObjectReference = ContainsReference; \
+            static bool HasObjectReference() { return ContainsObjectReference; } \
             static void AddProperty(FFieldVariant Scope, uint16 FieldOffset, const FName& DebugName) \
             { \
                 DECLARE_WRAPPER_PROPERTY_INNER(PropertyType, PropertyGenType, InnerClass); \
             } \
+            static bool IsSameType(const FProperty* Property) \
+            { \
+                return IsPropertyOfClass(CastField<PropertyType>(Property), ValueClass); \
+            } \
         }
 
 #if UE_VERSION_OLDER_THAN(5,5,0)
@@ -92,7 +148,7 @@ namespace UnrealMvvm_Impl
                 : FTextProperty_Super(InOwner, (const UECodeGen_Private::FPropertyParamsBaseWithOffset&)Prop)
             {}
         };
-        DECLARE_SIMPLE_PROPERTY(FText, FFakeTextProperty, Text); // should be FTextProperty, but its constructor is not exported in 5.3
+        DECLARE_SIMPLE_PROPERTY_EX(FText, FFakeTextProperty, FTextProperty, Text); // should be FTextProperty, but its constructor is not exported in 5.3
 #else
         DECLARE_SIMPLE_PROPERTY(FText, FTextProperty, Text);
 #endif
@@ -110,11 +166,11 @@ namespace UnrealMvvm_Impl
         DECLARE_SIMPLE_PROPERTY(uint32, FUInt32Property, UInt32);
         DECLARE_SIMPLE_PROPERTY(uint64, FUInt64Property, UInt64);
 
-        DECLARE_WRAPPER_PROPERTY(TScriptInterface<TValue>, FInterfaceProperty, Interface, true, StaticClassWrapper<typename TValue::UClassType>);
-        DECLARE_WRAPPER_PROPERTY(TLazyObjectPtr<TValue>, FLazyObjectProperty, LazyObject, false, StaticClassWrapper<TValue>);
-        DECLARE_WRAPPER_PROPERTY(TSoftClassPtr<TValue>, FSoftClassProperty, SoftClass, false, StaticClassWrapper<TValue>);
-        DECLARE_WRAPPER_PROPERTY(TSoftObjectPtr<TValue>, FSoftObjectProperty, SoftObject, false, StaticClassWrapper<TValue>);
-        DECLARE_WRAPPER_PROPERTY(TWeakObjectPtr<TValue>, FWeakObjectProperty, WeakObject, false, StaticClassWrapper<TValue>);
+        DECLARE_WRAPPER_PROPERTY(TScriptInterface<TValue>, FInterfaceProperty, Interface, true, StaticClassWrapper<typename TValue::UClassType>, TValue::UClassType::StaticClass());
+        DECLARE_WRAPPER_PROPERTY(TLazyObjectPtr<TValue>, FLazyObjectProperty, LazyObject, false, StaticClassWrapper<TValue>, TValue::StaticClass());
+        DECLARE_WRAPPER_PROPERTY(TSoftClassPtr<TValue>, FSoftClassProperty, SoftClass, false, StaticClassWrapper<TValue>, TValue::StaticClass());
+        DECLARE_WRAPPER_PROPERTY(TSoftObjectPtr<TValue>, FSoftObjectProperty, SoftObject, false, StaticClassWrapper<TValue>, TValue::StaticClass());
+        DECLARE_WRAPPER_PROPERTY(TWeakObjectPtr<TValue>, FWeakObjectProperty, WeakObject, false, StaticClassWrapper<TValue>, TValue::StaticClass());
 
         /* bool property. It does not fit into DECLARE_SIMPLE_PROPERTY */
         template <>
@@ -122,10 +178,18 @@ namespace UnrealMvvm_Impl
         {
             static constexpr bool IsSupportedByUnreal = true;
             static constexpr bool ContainsObjectReference = false;
+            static bool HasObjectReference() { return ContainsObjectReference; }
             static void AddProperty(FFieldVariant Scope, uint16 FieldOffset, const FName& DebugName)
             {
                 new FBoolProperty(COMMON_PROPERTY_PARAMS(Bool, sizeof(bool), 0, nullptr));
             }
+
+            static bool IsSameType(const FProperty* Property)
+            {
+                // bitfield bools cannot be copied from a native bool
+                const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property);
+                return BoolProperty && BoolProperty->IsNativeBool();
+            }
         };
 
         /* UObject pointer */
@@ -134,11 +198,17 @@ namespace UnrealMvvm_Impl
         {
             static constexpr bool IsSupportedByUnreal = true;
             static constexpr bool ContainsObjectReference = true;
+            static bool HasObjectReference() { return ContainsObjectReference; }
 
             static void AddProperty(FFieldVariant Scope, uint16 FieldOffset, const FName& DebugName)
             {
                 DECLARE_WRAPPER_PROPERTY_INNER(FObjectProperty, Object, StaticClassWrapper<TValue>);
             }
+
+            static bool IsSameType(const FProperty* Property)
+            {
+                return IsPropertyOfClass(CastField<FObjectProperty>(Property), TValue::StaticClass());
+            }
         };
 
         /* TObjectPtr<> pointer */
@@ -147,11 +217,17 @@ namespace UnrealMvvm_Impl
         {
             static constexpr bool IsSupportedByUnreal = true;
             static constexpr bool ContainsObjectReference = true;
+            static bool HasObjectReference() { return ContainsObjectReference; }
 
             static void AddProperty(FFieldVariant Scope, uint16 FieldOffset, const FName& DebugName)
             {
                 DECLARE_WRAPPER_PROPERTY_INNER(FObjectProperty, Object, StaticClassWrapper<TValue>);
             }
+
+            static bool IsSameType(const FProperty* Property)
+            {
+                return IsPropertyOfClass(CastField<FObjectProperty>(Property), TValue::StaticClass());
+            }
         };
 
         /* UStruct value */
@@ -161,10 +237,23 @@ namespace UnrealMvvm_Impl
             static constexpr bool IsSupportedByUnreal = true;
             static constexpr bool ContainsObjectReference = true; // assume true, we cannot easily check this in compile time
 
+            static bool HasObjectReference()
+            {
+                // RefLink lists properties with object references, it is filled when struct is linked
+                const UScriptStruct* Struct = TValue::StaticStruct();
+                return (Struct->StructFlags & STRUCT_AddStructReferencedObjects) != 0 || Struct->RefLink != nullptr;
+            }
+
             static void AddProperty(FFieldVariant Scope, uint16 FieldOffset, const FName& DebugName)
             {
                 DECLARE_WRAPPER_PROPERTY_INNER(FStructProperty, Struct, StaticStructWrapper<TValue>);
             }
+
+            static bool IsSameType(const FProperty* Property)
+            {
+                const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+                return StructProperty && StructProperty->Struct == TValue::StaticStruct();
+            }
         };
 
         /* TArray<> */
@@ -173,15 +262,22 @@ namespace UnrealMvvm_Impl
         {
             static constexpr bool IsSupportedByUnreal = true;
             static constexpr bool ContainsObjectReference = TPropertyFactory<TValue>::ContainsObjectReference;
+            static bool HasObjectReference() { return TPropertyFactory<TValue>::HasObjectReference(); }
 
             static void AddProperty(FFieldVariant Scope, uint16 FieldOffset, const FName& DebugName)
             {
-                if (ContainsObjectReference)
+                if (HasObjectReference())
                 {
                     auto Prop = new FArrayProperty(COMMON_PROPERTY_PARAMS(Array, FieldOffset, EArrayPropertyFlags::None));
                     TPropertyFactory<TValue>::AddProperty(Prop, FieldOffset, FName(DebugName.ToString() + TEXT("_Value")));
                 }
             }
+
+            static bool IsSameType(const FProperty* Property)
+            {
+                const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property);
+                return ArrayProperty && TPropertyFactory<TValue>::IsSameType(ArrayProperty->Inner);
+            }
         };
 
         /* TSet<> */
@@ -190,15 +286,22 @@ namespace UnrealMvvm_Impl
         {
             static constexpr bool IsSupportedByUnreal = true;
             static constexpr bool ContainsObjectReference = TPropertyFactory<TValue>::ContainsObjectReference;
+            static bool HasObjectReference() { return TPropertyFactory<TValue>::HasObjectReference(); }
 
             static void AddProperty(FFieldVariant Scope, uint16 FieldOffset, const FName& DebugName)
             {
-                if (ContainsObjectReference)
+                if (HasObjectReference())
                 {
                     auto Prop = new FSetProperty(COMMON_PROPERTY_PARAMS(Set, FieldOffset));
                     TPropertyFactory<TValue>::AddProperty(Prop, FieldOffset, FName(DebugName.ToString() + TEXT("_Value")));
                 }
             }
+
+            static bool IsSameType(const FProperty* Property)
+            {
+                const FSetProperty* SetProperty = CastField<FSetProperty>(Property);
+                return SetProperty && TPropertyFactory<TValue>::IsSameType(SetProperty->ElementProp);
+            }
         };
 
         /* TMap<,> */
@@ -207,6 +310,7 @@ namespace UnrealMvvm_Impl
         {
             static constexpr bool IsSupportedByUnreal = true;
             static constexpr bool ContainsObjectReference = TPropertyFactory<TKey>::ContainsObjectReference || TPropertyFactory<TValue>::ContainsObjectReference;
+            static bool HasObjectReference() { return TPropertyFactory<TKey>::HasObjectReference() || TPropertyFactory<TValue>::HasObjectReference(); }
 
             static void AddProperty(FFieldVariant Scope, uint16 FieldOffset, const FName& DebugName)
             {
@@ -217,16 +321,23 @@ namespace UnrealMvvm_Impl
                 static_assert(!ContainsObjectReference || TPropertyFactory<TKey>::IsSupportedByUnreal, "Unsupported Key Type");
                 static_assert(!ContainsObjectReference || TPropertyFactory<TValue>::IsSupportedByUnreal, "Unsupported Value Type");
 
-                if (ContainsObjectReference)
+                if (HasObjectReference())
                 {
                     auto Prop = new FMapProperty(COMMON_PROPERTY_PARAMS(Map, FieldOffset, EMapPropertyFlags::None));
                     TPropertyFactory<TKey>::AddProperty(Prop, 0, FName(DebugName.ToString() + TEXT("_Key")));
                     TPropertyFactory<TValue>::AddProperty(Prop, 1, FName(DebugName.ToString() + TEXT("_Value")));
                 }
             }
+
+            static bool IsSameType(const FProperty* Property)
+            {
+                const FMapProperty* MapProperty = CastField<FMapProperty>(Property);
+                return MapProperty && TPropertyFactory<TKey>::IsSameType(MapProperty->KeyProp) && TPropertyFactory<TValue>::IsSameType(MapProperty->ValueProp);
+            }
         };
 
 #undef DECLARE_SIMPLE_PROPERTY
+#undef DECLARE_SIMPLE_PROPERTY_EX
 #undef DECLARE_SIMPLE_PROPERTY_INNER
 #undef DECLARE_WRAPPER_PROPERTY
 #undef DECLARE_WRAPPER_PROPERTY_INNER
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Containers/ArrayView.h"
+#include "UObject/Object.h"
 
 class FField;
 class UClass;
@@ -13,8 +14,8 @@ namespace UnrealMvvm_Impl
 
     struct UNREALMVVM_API FTokenStreamUtils
     {
-        /* Adds all derived classes to a provided list */
-        static void EnrichWithDerivedClasses(TArray<UClass*>& Classes);
+        /* Adds all derived classes to a provided list. All classes must be derived from RootClass */
+        static void EnrichWithDerivedClasses(TArray<UClass*>& Classes, UClass* RootClass = UObject::StaticClass());
 
         /* Sorts classes so Base ones goes before Derived ones */
         static void SortViewModelClasses(TArray<UClass*>& Classes);
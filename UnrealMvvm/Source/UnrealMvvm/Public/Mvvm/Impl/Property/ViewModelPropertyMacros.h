@@ -32,7 +32,7 @@
 
 #endif
 
-// creates PropertyGetter method with provided Getter and Setter visibility
+// creates PropertyGetter method with provided Getter and Setter visibility, visibility is also kept for VM_STRUCT_PROP_IMPL
 #define UMVVM_IMPL_PROP_PROPERTY_GETTER_2(Name, ValueType, GetterPtr, SetterPtr, FieldOffset, GetterVisibility, SetterVisibility) \
     using F##Name##Property = TViewModelProperty<ThisClass, UMVVM_IMPL_RP(ValueType)>; \
     static const TViewModelProperty<ThisClass, UMVVM_IMPL_RP(ValueType)>* Name##Property() \
@@ -40,7 +40,9 @@
         return &Name##PropertyValue; \
     } \
 private: \
-    static F##Name##Property Name##PropertyValue;
+    static F##Name##Property Name##PropertyValue; \
+    static constexpr FViewModelPropertyBase::EAccessorVisibility Name##PropertyGetterVisibility = FViewModelPropertyBase::EAccessorVisibility::V_##GetterVisibility; \
+    static constexpr FViewModelPropertyBase::EAccessorVisibility Name##PropertySetterVisibility = FViewModelPropertyBase::EAccessorVisibility::V_##SetterVisibility;
 
 // creates PropertyGetter method with provided Setter visibility and default Getter visibility (public)
 #define UMVVM_IMPL_PROP_PROPERTY_GETTER_1(Name, ValueType, GetterPtr, SetterPtr, FieldOffset, SetterVisibility) \
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "Mvvm/ViewModelProperty.h"
+#include "Mvvm/ViewModelPropertyTypeTraits.h"
+#include "Mvvm/Impl/Property/CanCompareHelper.h"
 #include "Mvvm/Impl/Property/PropertyFactory.h"
 
 template<typename TOwner, typename TValue>
@@ -106,8 +108,9 @@ namespace UnrealMvvm_Impl
             {
                 check(TargetClass);
 
+                // properties without object references produce no GC tokens, so there is no need to create them
                 const TViewModelProperty<TOwner, TValue>* Prop = this->GetCastedProperty();
-                if (Prop->GetFieldOffset() > 0)
+                if (Prop->GetFieldOffset() > 0 && TPropertyFactory<typename TDecay<TValue>::Type>::HasObjectReference())
                 {
                     TPropertyFactory<typename TDecay<TValue>::Type>::AddProperty(TargetClass, Prop->GetFieldOffset(), Prop->GetName());
                 }
@@ -115,7 +118,7 @@ namespace UnrealMvvm_Impl
 
             bool ContainsObjectReference(bool bIncludeNoFieldProperties) const override
             {
-                return TPropertyFactory<typename TDecay<TValue>::Type>::ContainsObjectReference &&
+                return TPropertyFactory<typename TDecay<TValue>::Type>::HasObjectReference() &&
                     (this->GetCastedProperty()->GetFieldOffset() > 0 || bIncludeNoFieldProperties);
             }
         };
@@ -151,6 +154,89 @@ namespace UnrealMvvm_Impl
                 return TRemoveObjectPointer<typename TRemovePointer<TValue>::Type>::Type::StaticClass();
             }
         };
+
+        /* Implementation of HasEqualValues method */
+        template <typename TBaseOp, typename TOwner, typename TValue>
+        struct THasEqualValuesOperation : public TBaseOp
+        {
+            bool HasEqualValues(UBaseViewModel* InFirst, UBaseViewModel* InSecond) const override
+            {
+                check(InFirst);
+                check(InSecond);
+
+                using TDecayedValue = typename TBaseOp::TDecayedValue;
+
+                // values are compared only if property setter would compare them
+                if constexpr (TViewModelPropertyTypeTraits<TDecayedValue>::WithSetterComparison && TCanCompareHelper<TDecayedValue>::Value)
+                {
+                    const TDecayedValue& First = this->GetCastedProperty()->GetValue((TOwner*)InFirst);
+                    const TDecayedValue& Second = this->GetCastedProperty()->GetValue((TOwner*)InSecond);
+
+                    return AreValuesEqual<TDecayedValue>(First, Second);
+                }
+                else
+                {
+                    return false;
+                }
+            }
+        };
+    }
+
+    namespace Details
+    {
+        template <typename T>
+        struct TOptionalElement
+        {
+            using Type = T;
+        };
+
+        template <typename T>
+        struct TOptionalElement<TOptional<T>>
+        {
+            using Type = T;
+        };
+
+        /* Implementation of IsSameType method */
+        template <typename TBaseOp, typename TOwner, typename TValue>
+        struct TIsSameTypeOperation : public TBaseOp
+        {
+            bool IsSameType(const FProperty* Target) const override
+            {
+                check(Target);
+
+                // GetValue writes element of TOptional, so only its type matters
+                using TElement = typename TOptionalElement<typename TBaseOp::TDecayedValue>::Type;
+                return TPropertyFactory<TElement>::IsSameType(Target);
+            }
+        };
+
+        /* Implementation of IsPrimitiveType method */
+        template <typename TBaseOp, typename TOwner, typename TValue>
+        struct TIsPrimitiveTypeOperation : public TBaseOp
+        {
+            bool IsPrimitiveType(EPrimitiveValueType Type) const override
+            {
+                using TElement = typename TOptionalElement<typename TBaseOp::TDecayedValue>::Type;
+
+                switch (Type)
+                {
+                case EPrimitiveValueType::Bool:
+                    return std::is_same_v<TElement, bool>;
+                case EPrimitiveValueType::Byte:
+                    return std::is_same_v<TElement, uint8>;
+                case EPrimitiveValueType::Int:
+                    return std::is_same_v<TElement, int32>;
+                case EPrimitiveValueType::Int64:
+                    return std::is_same_v<TElement, int64>;
+                case EPrimitiveValueType::Float:
+                    return std::is_same_v<TElement, float>;
+                case EPrimitiveValueType::Double:
+                    return std::is_same_v<TElement, double>;
+                default:
+                    return false;
+                }
+            }
+        };
     }
 
     template <typename TBaseOp>
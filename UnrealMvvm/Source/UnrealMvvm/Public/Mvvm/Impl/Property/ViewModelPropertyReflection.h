@@ -36,6 +36,17 @@ namespace UnrealMvvm_Impl
     };
 #endif
 
+    // primitive types that values of property may be checked against at runtime
+    enum class EPrimitiveValueType : uint8
+    {
+        Bool,
+        Byte,
+        Int,
+        Int64,
+        Float,
+        Double,
+    };
+
     // contains operations that can be performed with property
     struct UNREALMVVM_API FViewModelPropertyOperations
     {
@@ -59,6 +70,15 @@ namespace UnrealMvvm_Impl
         // Returns UClass of value contained inside the property. Returns nullptr if Value is not a pointer to a class 
         virtual UClass* GetValueClass() const = 0;
 
+        // Returns whether both ViewModels have equal values of this property. Returns false if values cannot be compared
+        virtual bool HasEqualValues(UBaseViewModel* InFirst, UBaseViewModel* InSecond) const = 0;
+
+        // Returns whether value returned by GetValue can be copied into Target as is. Element type is checked for TOptional properties
+        virtual bool IsSameType(const FProperty* Target) const = 0;
+
+        // Returns whether value returned by GetValue is of given primitive type. Element type is checked for TOptional properties
+        virtual bool IsPrimitiveType(EPrimitiveValueType Type) const = 0;
+
         // Pointer to a FViewModelPropertyBase
         const FViewModelPropertyBase* Property;
     };
@@ -36,6 +36,9 @@ namespace UnrealMvvm_Impl
         static void ProcessPendingRegistrations();
         static void DeleteKeptProperties();
 
+        /* Regenerates GC token streams of given ViewModel classes and all classes derived from them */
+        static void GenerateReferenceTokenStreams(TArray<UClass*> ViewModelClasses);
+
     private:
         friend class FViewModelPropertyIterator;
 
@@ -84,8 +87,11 @@ inline void UnrealMvvm_Impl::FViewModelRegistry::RegisterProperty(const TViewMod
     using FAddPropOps = Details::TAddClassPropertyOperation<FSetOps, TOwner, TValue>;
     using FGetVMOps   = Details::TGetViewModelClassOperation<FAddPropOps, TOwner, TValue>;
     using FGetClassOps = Details::TGetValueClassOperation<FGetVMOps, TOwner, TValue, IsObject>;
+    using FCompareOps = Details::THasEqualValuesOperation<FGetClassOps, TOwner, TValue>;
+    using FSameTypeOps = Details::TIsSameTypeOperation<FCompareOps, TOwner, TValue>;
+    using FPrimitiveTypeOps = Details::TIsPrimitiveTypeOperation<FSameTypeOps, TOwner, TValue>;
 
-    using FEffectiveOpsType = TViewModelPropertyOperations<FGetClassOps>;
+    using FEffectiveOpsType = TViewModelPropertyOperations<FPrimitiveTypeOps>;
 
     static_assert(sizeof(FViewModelPropertyOperations) == sizeof(FEffectiveOpsType), "Generated Operations type cannot fit into OpsBuffer");
 
@@ -7,6 +7,7 @@
 template<typename T> class TMulticastDelegateBase; // 4.26 and above
 template<typename T> class FMulticastDelegateBase; // 4.25 and below
 
+#include "Mvvm/Impl/ListenManager/EventCoalescingProxy.h"
 #include "Mvvm/Impl/Utils/PointerToMember.h"
 #include "Templates/EnableIf.h"
 #include "Delegates/Delegate.h"
@@ -76,7 +77,40 @@ public:
             Subscription.Unsubscribe();
         }
 
-        Subscriptions.Empty();
+        Subscriptions.Reset();
+    }
+
+    /*
+     * Removes all bindings of Subscriber from given event in a single pass, including bindings that were not made through this manager.
+     * Subscriber is the object passed to WithUObject, WithSP, WithWeakLambda or WithDynamic
+     */
+    template<typename TWidget, typename TEventPtr, typename TSubscriber>
+    void UnsubscribeAll(TWidget* Widget, TEventPtr Event, TSubscriber* Subscriber)
+    {
+        if (Widget == nullptr || Subscriber == nullptr)
+        {
+            return;
+        }
+
+        auto& EventRef = std::mem_fn(Event)(Widget);
+        EventRef.RemoveAll(Subscriber);
+
+        const void* EventAddress = &EventRef;
+        Subscriptions.RemoveAll([EventAddress, Subscriber](FSubscription& Subscription)
+        {
+            if (Subscription.EventAddress != EventAddress || Subscription.Subscriber != Subscriber)
+            {
+                return false;
+            }
+
+            // coalesced bindings are not bound to Subscriber directly, they are removed one by one
+            if (!Subscription.bBoundToSubscriber)
+            {
+                Subscription.Unsubscribe();
+            }
+
+            return true;
+        });
     }
 
     ~FListenManager()
@@ -89,11 +123,17 @@ private:
     template<typename T1, typename T2> friend class UnrealMvvm_Impl::TDynamicEventListenHelper;
     template<typename T1, typename T2> friend class UnrealMvvm_Impl::TSimpleEventListenHelper;
 
+    /* Number of subscriptions stored without heap allocation. List entry widgets rarely listen to more events */
+    static constexpr int32 NumInlineSubscriptions = 4;
+
     template<typename TUnsubscriber, typename... TArgs>
-    void AddSubscription(TArgs... Args)
+    void AddSubscription(const void* EventAddress, const void* Subscriber, bool bBoundToSubscriber, TArgs... Args)
     {
         int32 NewIndex = Subscriptions.AddUninitialized();
         FSubscription& Subscription = Subscriptions[NewIndex];
+        Subscription.EventAddress = EventAddress;
+        Subscription.Subscriber = Subscriber;
+        Subscription.bBoundToSubscriber = bBoundToSubscriber;
         new (Subscription.Buffer) TUnsubscriber(Args...);
     }
 
@@ -106,7 +146,7 @@ private:
     {
         enum
         {
-            // this size should be enough to hold TObjectUnsubscriber or THandleUnsubscriber
+            // this size should be enough to hold TObjectUnsubscriber, TProxyUnsubscriber or THandleUnsubscriber
             // we cannot just use sizeof(THandleUnsubscriber) because it is templated and its size depends on template arguments
             StorageCapacity =
                 sizeof(FBaseUnsubscriber) + // base class (VTable pointer)
@@ -115,6 +155,13 @@ private:
                 sizeof(FDelegateHandle)     // UObject* or FDelegateHandle (this thing is equal or larger than void*)
         };
 
+        // used by bulk removal, Subscriber is null when binding has no owning object (e.g. lambda)
+        const void* EventAddress;
+        const void* Subscriber;
+
+        // whether binding is removed by calling RemoveAll(Subscriber) on event
+        bool bBoundToSubscriber;
+
         uint8 Buffer[StorageCapacity];
 
         void Unsubscribe()
@@ -145,6 +192,29 @@ private:
         UObject* Subscriber;
     };
 
+    template<typename TWidget, typename TEventPtr>
+    struct TProxyUnsubscriber : public FBaseUnsubscriber
+    {
+        TProxyUnsubscriber(TWidget* InWidget, TEventPtr InEvent, UEventCoalescingProxy* InProxy)
+            : Widget(InWidget)
+            , Event(InEvent)
+            , Proxy(InProxy)
+        {
+            static_assert(FSubscription::StorageCapacity >= sizeof(*this), "Not enough storage for TProxyUnsubscriber");
+        }
+
+        void Unsubscribe() override
+        {
+            auto& EventRef = std::mem_fn(Event)(Widget);
+            EventRef.RemoveAll(Proxy);
+            Proxy->Release();
+        }
+
+        TWidget* Widget;
+        TEventPtr Event;
+        UEventCoalescingProxy* Proxy;
+    };
+
     template<typename TWidget, typename TEventPtr>
     struct THandleUnsubscriber : public FBaseUnsubscriber
     {
@@ -167,7 +237,7 @@ private:
         FDelegateHandle Handle;
     };
 
-    TArray<FSubscription> Subscriptions;
+    TArray<FSubscription, TInlineAllocator<NumInlineSubscriptions>> Subscriptions;
 };
 
 #include "Mvvm/Impl/ListenManager/DynamicEventListenHelper.h"
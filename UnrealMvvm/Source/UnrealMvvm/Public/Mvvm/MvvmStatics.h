@@ -78,6 +78,37 @@ public:
         return IsChangingPropertyFromViewModel(ViewModel);
     }
 
+    /* Enables diff-based rebind for a View widget. When enabled, replacing ViewModel of a constructed View invokes only bindings whose values differ */
+    static void SetDiffRebindEnabled(UUserWidget* View, bool bEnabled)
+    {
+        SetDiffRebindEnabledInWidget(View, bEnabled);
+    }
+
+    /* Enables diff-based rebind for a View actor. When enabled, replacing ViewModel of a constructed View invokes only bindings whose values differ */
+    static void SetDiffRebindEnabled(AActor* View, bool bEnabled)
+    {
+        SetDiffRebindEnabledInActor(View, bEnabled);
+    }
+
+    /* Enables diff-based propagation for a View widget. When enabled, replacing ViewModel in the middle of Property Path invokes only bindings whose values differ */
+    static void SetDiffPropagationEnabled(UUserWidget* View, bool bEnabled)
+    {
+        SetDiffPropagationEnabledInWidget(View, bEnabled);
+    }
+
+    /* Enables diff-based propagation for a View actor. When enabled, replacing ViewModel in the middle of Property Path invokes only bindings whose values differ */
+    static void SetDiffPropagationEnabled(AActor* View, bool bEnabled)
+    {
+        SetDiffPropagationEnabledInActor(View, bEnabled);
+    }
+
+    /*
+     * Sets texts of all text bindings (Bind to SetText, including numeric formatting) of all active Views again. Other bindings are not invoked.
+     * Call it after culture is changed. Work is spread across frames, each frame spends at most MaxMillisecondsPerFrame. Zero means no limit
+     */
+    UFUNCTION(BlueprintCallable, Category = "ViewModel")
+    static void RefreshTextBindings(float MaxMillisecondsPerFrame = 1.f);
+
 private:
     // to access GetViewModelPropertyValueFrom... and SetViewModelPropertyValueTo... via GET_MEMBER_NAME_CHECKED
     friend class FViewModelPropertyNodeHelper;
@@ -136,6 +167,22 @@ private:
     UFUNCTION(BlueprintPure, Category = "ViewModel")
     static bool IsChangingPropertyFromViewModel(UBaseViewModel* ViewModel);
 
+    /* Enables diff-based rebind for a View widget. When enabled, replacing ViewModel of a constructed View invokes only bindings whose values differ */
+    UFUNCTION(BlueprintCallable, Category = "ViewModel", meta = (DefaultToSelf = "View"))
+    static void SetDiffRebindEnabledInWidget(UUserWidget* View, bool bEnabled);
+
+    /* Enables diff-based rebind for a View actor. When enabled, replacing ViewModel of a constructed View invokes only bindings whose values differ */
+    UFUNCTION(BlueprintCallable, Category = "ViewModel", meta = (DefaultToSelf = "View"))
+    static void SetDiffRebindEnabledInActor(AActor* View, bool bEnabled);
+
+    /* Enables diff-based propagation for a View widget. When enabled, replacing ViewModel in the middle of Property Path invokes only bindings whose values differ */
+    UFUNCTION(BlueprintCallable, Category = "ViewModel", meta = (DefaultToSelf = "View"))
+    static void SetDiffPropagationEnabledInWidget(UUserWidget* View, bool bEnabled);
+
+    /* Enables diff-based propagation for a View actor. When enabled, replacing ViewModel in the middle of Property Path invokes only bindings whose values differ */
+    UFUNCTION(BlueprintCallable, Category = "ViewModel", meta = (DefaultToSelf = "View"))
+    static void SetDiffPropagationEnabledInActor(AActor* View, bool bEnabled);
+
     DECLARE_FUNCTION(execGetViewModelPropertyValue);
     DECLARE_FUNCTION(execSetViewModelPropertyValue);
 
@@ -144,4 +191,10 @@ private:
 
     template <typename TView, typename TViewComponent>
     static void SetViewModelInternal(TView* View, UBaseViewModel* ViewModel);
+
+    template <typename TView, typename TViewComponent>
+    static void SetDiffRebindEnabledInternal(TView* View, bool bEnabled);
+
+    template <typename TView, typename TViewComponent>
+    static void SetDiffPropagationEnabledInternal(TView* View, bool bEnabled);
 };
@@ -4,6 +4,7 @@
 
 #include "Containers/Array.h"
 #include "Templates/IsInvocable.h"
+#include "HAL/PlatformTime.h"
 #include "Misc/EngineVersionComparison.h"
 
 #ifndef UE_REQUIRES
@@ -104,4 +105,141 @@ namespace MvvmUtils
             ++Index;
         }
     }
+
+    /*
+     * Cursor of incremental synchronization performed by SyncViewModelCollectionIncremental.
+     * Keep it between calls to resume synchronization from where previous call stopped
+     */
+    class FSyncViewModelCollectionCursor
+    {
+    public:
+        /* Maximum number of Models processed per call */
+        int32 MaxItemsPerCall = MAX_int32;
+
+        /* Maximum time spent per call in seconds. Zero means no limit. At least one Model is processed per call regardless of this value */
+        double MaxSecondsPerCall = 0.0;
+
+        /* Returns number of Models already assigned to ViewModels */
+        int32 GetNumProcessed() const { return NumProcessed; }
+
+        /* Returns number of Models being synchronized */
+        int32 GetNumTotal() const { return NumTotal; }
+
+        /* Returns progress in range [0, 1] */
+        float GetProgress() const { return NumTotal > 0 ? (float)NumProcessed / NumTotal : 1.f; }
+
+        /* Returns whether synchronization is completed */
+        bool IsComplete() const { return NumTotal != INDEX_NONE && NumProcessed == NumTotal; }
+
+        /* Restarts synchronization on next call. Use it when content of Models was changed */
+        void Reset()
+        {
+            NumProcessed = 0;
+            NumTotal = INDEX_NONE;
+        }
+
+    private:
+        template <typename TViewModel, typename TAllocator, typename TModels, typename TFactory, typename TSetter>
+        friend bool SyncViewModelCollectionIncremental(TArray<TViewModel, TAllocator>&, const TModels&, FSyncViewModelCollectionCursor&, TFactory&&, TSetter&&);
+
+        int32 NumProcessed = 0;
+        int32 NumTotal = INDEX_NONE;
+    };
+
+    /*
+     * Incremental version of SyncViewModelCollection. Processes limited amount of Models per call, as configured in Cursor.
+     * Returns true when synchronization is completed.
+     *
+     * Models must support Num() and operator[], e.g. TArray or TArrayView. Changing number of Models restarts synchronization.
+     * ViewModels are created only when their Model is processed, so every ViewModel in the collection always has a valid Model:
+     * first GetNumProcessed() ViewModels have new Models, the rest keep their previous Models until processed
+     *
+     * ViewModels are created via NewObject<ViewModelType>()
+     * Models are assigned via call to `ViewModel->SetModel(Model);`
+     */
+    template <typename TViewModel, typename TAllocator, typename TModels>
+    bool SyncViewModelCollectionIncremental(TArray<TViewModel, TAllocator>& ViewModels, const TModels& Models, FSyncViewModelCollectionCursor& Cursor)
+    {
+        return SyncViewModelCollectionIncremental(ViewModels, Models, Cursor, [] { return NewObject<TPointedToType<TViewModel>>(); }, [](auto* ViewModel, auto& Model) { ViewModel->SetModel(Model); });
+    }
+
+    /*
+     * Incremental version of SyncViewModelCollection. See above for details
+     *
+     * ViewModels are created via provided Factory function. It has following signature: ViewModel* ()
+     * Models are assigned via call to `ViewModel->SetModel(Model);`
+     */
+    template <typename TViewModel, typename TAllocator, typename TModels, typename TFactory UE_REQUIRES(TIsInvocable<TFactory>::Value)>
+    bool SyncViewModelCollectionIncremental(TArray<TViewModel, TAllocator>& ViewModels, const TModels& Models, FSyncViewModelCollectionCursor& Cursor, TFactory&& Factory)
+    {
+        return SyncViewModelCollectionIncremental(ViewModels, Models, Cursor, Factory, [](auto* ViewModel, auto& Model) { ViewModel->SetModel(Model); });
+    }
+
+    /*
+     * Incremental version of SyncViewModelCollection. See above for details
+     *
+     * ViewModels are created via NewObject<ViewModelType>()
+     * Models are assigned via call to provided Setter function. It has following signature: void (ViewModelType* ViewModel, const ModelType& Model)
+     */
+    template <typename TViewModel, typename TAllocator, typename TModels, typename TSetter UE_REQUIRES(!TIsInvocable<TSetter>::Value)>
+    bool SyncViewModelCollectionIncremental(TArray<TViewModel, TAllocator>& ViewModels, const TModels& Models, FSyncViewModelCollectionCursor& Cursor, TSetter&& Setter)
+    {
+        return SyncViewModelCollectionIncremental(ViewModels, Models, Cursor, [] { return NewObject<TPointedToType<TViewModel>>(); }, Setter);
+    }
+
+    /*
+     * Incremental version of SyncViewModelCollection. See above for details
+     *
+     * ViewModels are created via provided Factory function. It has following signature: ViewModel* ()
+     * Models are assigned via call to provided Setter function. It has following signature: void (ViewModelType* ViewModel, const ModelType& Model)
+     */
+    template <typename TViewModel, typename TAllocator, typename TModels, typename TFactory, typename TSetter>
+    bool SyncViewModelCollectionIncremental(TArray<TViewModel, TAllocator>& ViewModels, const TModels& Models, FSyncViewModelCollectionCursor& Cursor, TFactory&& Factory, TSetter&& Setter)
+    {
+        static_assert(TIsPointerOrObjectPtrToBaseOf<TViewModel, UBaseViewModel>::Value, "ViewModels array must contain pointers to or TObjectPtrs of UBaseViewModel");
+        check(Cursor.MaxItemsPerCall > 0);
+
+        const int32 NumModels = Models.Num();
+
+        if (Cursor.NumTotal != NumModels)
+        {
+            // start over, Models of already processed ViewModels may be shifted
+            Cursor.NumProcessed = 0;
+            Cursor.NumTotal = NumModels;
+
+            ViewModels.Reserve(NumModels);
+
+            if (ViewModels.Num() > NumModels)
+            {
+#if UE_VERSION_OLDER_THAN(5,5,0)
+                ViewModels.RemoveAt(NumModels, ViewModels.Num() - NumModels, false);
+#else
+                ViewModels.RemoveAt(NumModels, ViewModels.Num() - NumModels, EAllowShrinking::No);
+#endif
+            }
+        }
+
+        const double EndTime = Cursor.MaxSecondsPerCall > 0.0 ? FPlatformTime::Seconds() + Cursor.MaxSecondsPerCall : 0.0;
+        const int32 EndIndex = NumModels - Cursor.NumProcessed > Cursor.MaxItemsPerCall ? Cursor.NumProcessed + Cursor.MaxItemsPerCall : NumModels;
+
+        int32 Index = Cursor.NumProcessed;
+        while (Index < EndIndex)
+        {
+            if (Index == ViewModels.Num())
+            {
+                ViewModels.Add(Factory());
+            }
+
+            Setter(ToRawPtr(ViewModels[Index]), Models[Index]);
+            ++Index;
+
+            if (EndTime > 0.0 && FPlatformTime::Seconds() >= EndTime)
+            {
+                break;
+            }
+        }
+
+        Cursor.NumProcessed = Index;
+        return Cursor.IsComplete();
+    }
 }
@@ -0,0 +1,128 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Mvvm/BaseStructViewModel.h"
+#include "Mvvm/Impl/Binding/BindImpl.h"
+#include "Mvvm/Impl/Binding/IPropertyChangeHandler.h"
+
+/*
+ * Set of bindings to a ViewModel derived from FBaseStructViewModel.
+ * Pass pointer to it into regular Bind functions instead of View:
+ *   Bind(&RowBinding, FMyRowViewModel::NameProperty(), NameText);
+ *
+ * Only properties of the ViewModel itself are supported, Property Paths and two-way bindings are not,
+ * because struct ViewModels are not registered in FViewModelRegistry
+ */
+template <typename TViewModel>
+class TStructViewModelBinding
+{
+    static_assert(TIsDerivedFrom<TViewModel, FBaseStructViewModel>::Value, "TViewModel must be derived from FBaseStructViewModel");
+
+public:
+    using ViewModelType = TViewModel;
+
+    UE_NONCOPYABLE(TStructViewModelBinding);
+
+    TStructViewModelBinding() = default;
+
+    ~TStructViewModelBinding()
+    {
+        Unsubscribe();
+    }
+
+    TViewModel* GetViewModel() const
+    {
+        return ViewModel;
+    }
+
+    /* Replaces ViewModel and invokes all handlers with values of the new one */
+    void SetViewModel(TViewModel* InViewModel)
+    {
+        if (ViewModel == InViewModel)
+        {
+            return;
+        }
+
+        Unsubscribe();
+        ViewModel = InViewModel;
+
+        if (ViewModel != nullptr)
+        {
+            SubscriptionHandle = ViewModel->Subscribe(this, &TStructViewModelBinding::OnPropertyChanged);
+            Refresh();
+        }
+    }
+
+    /* Invokes all handlers again with current values, e.g. after FBindingWorker::RefreshTextBindings */
+    void Refresh() const
+    {
+        if (ViewModel != nullptr)
+        {
+            for (const FEntry& Entry : Entries)
+            {
+                Invoke(Entry);
+            }
+        }
+    }
+
+    /* Used by Bind functions */
+    bool IsTemplate() const
+    {
+        return false;
+    }
+
+private:
+    template<typename T, typename P, typename C>
+    friend void __BindImpl(T*, P, C&&);
+
+    struct FEntry
+    {
+        const FViewModelPropertyBase* Property;
+        TUniquePtr<UnrealMvvm_Impl::IStructPropertyChangeHandler> Handler;
+    };
+
+    template <typename THandler, typename... TArgs>
+    void EmplaceHandler(TArrayView<const FViewModelPropertyBase* const> PropertyPath, TArgs&&... Args)
+    {
+        FEntry& Entry = Entries.Emplace_GetRef();
+        Entry.Property = PropertyPath[0];
+        Entry.Handler = MakeUnique<THandler>(Forward<TArgs>(Args)...);
+
+        if (ViewModel != nullptr)
+        {
+            Invoke(Entry);
+        }
+    }
+
+    static void OnPropertyChanged(void* Owner, FBaseStructViewModel* ChangedViewModel, const FViewModelPropertyBase* Property)
+    {
+        const TStructViewModelBinding* This = static_cast<const TStructViewModelBinding*>(Owner);
+
+        for (const FEntry& Entry : This->Entries)
+        {
+            if (Entry.Property == Property)
+            {
+                This->Invoke(Entry);
+            }
+        }
+    }
+
+    void Invoke(const FEntry& Entry) const
+    {
+        Entry.Handler->Invoke(ViewModel, Entry.Property);
+    }
+
+    void Unsubscribe()
+    {
+        if (SubscriptionHandle.IsValid())
+        {
+            ViewModel->Unsubscribe(SubscriptionHandle);
+            SubscriptionHandle.Reset();
+        }
+    }
+
+    TViewModel* ViewModel = nullptr;
+    FBaseStructViewModel::FSubscriptionHandle SubscriptionHandle;
+    TArray<FEntry, TInlineAllocator<4>> Entries;
+};
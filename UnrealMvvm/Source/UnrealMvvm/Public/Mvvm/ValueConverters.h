@@ -0,0 +1,161 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Mvvm/Impl/Binding/TextFormattingCache.h"
+#include "Components/SlateWrapperTypes.h"
+#include "Containers/ArrayView.h"
+#include "Styling/SlateBrush.h"
+#include "Templates/UnrealTemplate.h"
+#include <type_traits>
+
+namespace UnrealMvvm_Impl
+{
+    /*
+     * Value converters are small functors that transform value of ViewModel property before it reaches the View.
+     * They are composed at compile time via operator| and stored by value inside binding handler, so common chains fit into its inline buffer.
+     * Every converter declares FValueConverterTag alias, a base class is not used because it breaks empty base optimization of composed converters
+     */
+    template <typename T, typename = void>
+    struct TIsValueConverter
+    {
+        static constexpr bool Value = false;
+    };
+
+    template <typename T>
+    struct TIsValueConverter<T, std::void_t<typename T::FValueConverterTag>>
+    {
+        static constexpr bool Value = true;
+    };
+
+    /* Passes result of First converter into Second one */
+    template <typename TFirst, typename TSecond>
+    struct TComposedConverter
+    {
+        using FValueConverterTag = void;
+
+        template <typename TValue>
+        decltype(auto) operator()(TValue&& Value) const
+        {
+            return Second(First(Forward<TValue>(Value)));
+        }
+
+        TFirst First;
+        TSecond Second;
+    };
+
+    template <typename TFirst, typename TSecond>
+    constexpr std::enable_if_t<TIsValueConverter<TFirst>::Value && TIsValueConverter<TSecond>::Value, TComposedConverter<TFirst, TSecond>>
+    operator|(TFirst First, TSecond Second)
+    {
+        return { First, Second };
+    }
+
+    struct FToVisibilityConverter
+    {
+        using FValueConverterTag = void;
+
+        ESlateVisibility operator()(bool bValue) const
+        {
+            return bValue ? WhenTrue : WhenFalse;
+        }
+
+        ESlateVisibility WhenTrue;
+        ESlateVisibility WhenFalse;
+    };
+
+    template <typename TValue>
+    struct TClampConverter
+    {
+        using FValueConverterTag = void;
+
+        TValue operator()(TValue Value) const
+        {
+            return FMath::Clamp(Value, Min, Max);
+        }
+
+        TValue Min;
+        TValue Max;
+    };
+
+    template <typename TValue>
+    struct TScaleConverter
+    {
+        using FValueConverterTag = void;
+
+        TValue operator()(TValue Value) const
+        {
+            return Value * Factor;
+        }
+
+        TValue Factor;
+    };
+
+    struct FToPercentTextConverter
+    {
+        using FValueConverterTag = void;
+
+        template <typename TValue>
+        FText operator()(TValue Value) const
+        {
+            static_assert(std::is_floating_point_v<TValue>, "Only float and double values can be formatted as percent");
+            return FNumberTextCache::FormatPercent(Value, FormatIndex);
+        }
+
+        int32 FormatIndex;
+    };
+
+    struct FEnumToBrushConverter
+    {
+        using FValueConverterTag = void;
+
+        template <typename TEnum>
+        const FSlateBrush& operator()(TEnum Value) const
+        {
+            const int32 Index = (int32)Value;
+            check(Brushes.IsValidIndex(Index));
+
+            return Brushes[Index];
+        }
+
+        TArrayView<const FSlateBrush> Brushes;
+    };
+}
+
+namespace MvvmConverters
+{
+    /* Converts bool to ESlateVisibility */
+    inline UnrealMvvm_Impl::FToVisibilityConverter ToVisibility(ESlateVisibility WhenTrue = ESlateVisibility::Visible, ESlateVisibility WhenFalse = ESlateVisibility::Collapsed)
+    {
+        return { WhenTrue, WhenFalse };
+    }
+
+    /* Clamps numeric value between Min and Max */
+    template <typename TValue>
+    UnrealMvvm_Impl::TClampConverter<TValue> Clamp(TValue Min, TValue Max)
+    {
+        return { Min, Max };
+    }
+
+    /* Multiplies numeric value by Factor */
+    template <typename TValue>
+    UnrealMvvm_Impl::TScaleConverter<TValue> Scale(TValue Factor)
+    {
+        return { Factor };
+    }
+
+    /* Formats float or double value as percent text, 1.0 becomes 100%. Texts are shared via FNumberTextCache */
+    inline UnrealMvvm_Impl::FToPercentTextConverter ToPercentText(const FNumberFormattingOptions* const Options = nullptr, const FCulturePtr& TargetCulture = nullptr)
+    {
+        return { UnrealMvvm_Impl::FNumberTextCache::GetFormatIndex(Options, TargetCulture) };
+    }
+
+    /*
+     * Selects brush by underlying value of enum. Brushes are not copied, so they must outlive the binding,
+     * e.g. be stored in a static array or in a property of the View that is not resized after bindings are created
+     */
+    inline UnrealMvvm_Impl::FEnumToBrushConverter EnumToBrush(TArrayView<const FSlateBrush> Brushes)
+    {
+        return { Brushes };
+    }
+}
@@ -0,0 +1,99 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Containers/Ticker.h"
+#include "Templates/UniquePtr.h"
+#include "UObject/GCObject.h"
+#include "Mvvm/ViewModelTickRate.h"
+
+class UClass;
+class UBaseViewModel;
+
+/*
+ * Ticks ViewModels that poll game state. ViewModels opt in via UBaseViewModel::SetTickRate and are ticked only while they have connected Views.
+ * ViewModels of the same class are ticked together, cost of each class is measured and available via GetClassStats
+ */
+class UNREALMVVM_API FViewModelTickManager : public FGCObject
+{
+public:
+    /* Accumulated cost of ticking ViewModels of a single class */
+    struct FClassStats
+    {
+        UClass* Class = nullptr;
+        EViewModelTickRate TickRate = EViewModelTickRate::None;
+        int32 NumViewModels = 0;
+        uint64 NumTicks = 0;
+        double LastTickSeconds = 0.0;
+        double TotalTickSeconds = 0.0;
+    };
+
+    static FViewModelTickManager& Get();
+
+    /* Destroys manager. Called when module is shut down */
+    static void Shutdown();
+
+    ~FViewModelTickManager();
+
+    /* Sets interval of given tick rate in seconds. Zero means every frame */
+    void SetTickInterval(EViewModelTickRate TickRate, float IntervalSeconds);
+
+    /* Returns interval of given tick rate in seconds */
+    float GetTickInterval(EViewModelTickRate TickRate) const;
+
+    /* Returns number of ViewModels currently being ticked */
+    int32 GetNumViewModels() const;
+
+    /* Returns stats of all classes that were ticked, including ones that have no ticking ViewModels anymore */
+    TArray<FClassStats> GetClassStats() const;
+
+    /* Drops accumulated stats and stats of classes that have no ticking ViewModels */
+    void ResetClassStats();
+
+    /* Ticks all groups which interval has passed. Called automatically by core ticker */
+    void Tick(float DeltaTime);
+
+    //~ Begin FGCObject interface
+    void AddReferencedObjects(FReferenceCollector& Collector) override;
+    FString GetReferencerName() const override;
+    //~ End FGCObject interface
+
+private:
+    friend class UBaseViewModel;
+
+    /* ViewModels of a single class. Each ViewModel knows its index in bucket, see UBaseViewModel::TickIndex */
+    struct FClassBucket
+    {
+        UClass* Class = nullptr;
+        TArray<TObjectPtr<UBaseViewModel>> ViewModels;
+    };
+
+    struct FTickGroup
+    {
+        float Interval = 0.f;
+        float AccumulatedTime = 0.f;
+        TArray<FClassBucket> Buckets;
+
+        // kept separately from buckets, because empty buckets are removed
+        TMap<UClass*, FClassStats> Stats;
+    };
+
+    void Add(UBaseViewModel* ViewModel, EViewModelTickRate TickRate);
+    void Remove(UBaseViewModel* ViewModel, EViewModelTickRate TickRate);
+
+    void TickGroup(FTickGroup& Group, float DeltaTime);
+    void UpdateTicker();
+
+    static TUniquePtr<FViewModelTickManager> Instance;
+
+    FTickGroup Groups[(int32)EViewModelTickRate::Num];
+    FTSTicker::FDelegateHandle TickerHandle;
+
+    int32 NumViewModels = 0;
+
+    // ViewModels removed while ticking are nulled and compacted after the tick
+    bool bTicking = false;
+    bool bHasRemovedWhileTicking = false;
+};
@@ -0,0 +1,16 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "HAL/Platform.h"
+
+/* How often ViewModel is ticked by FViewModelTickManager */
+enum class EViewModelTickRate : uint8
+{
+    None,
+    EveryFrame,
+    TenHz,
+    OneHz,
+
+    Num
+};
@@ -0,0 +1,283 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/BitArray.h"
+#include "Templates/Function.h"
+#include "UObject/GCObject.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Mvvm/BaseViewModel.h"
+
+/*
+ * Collection of ViewModels for huge lists of Models. Unlike MvvmUtils::SyncViewModelCollection it does not create ViewModel per Model,
+ * only ViewModels for the range requested by the list (plus prefetch margins on both sides) exist at any moment.
+ * ViewModels leaving that range are recycled for newly visible Models.
+ *
+ * Models are assigned via Setter function: bool (ViewModelType* ViewModel, int32 ModelIndex).
+ * Setter returns false if Model is not available yet. In that case FetchModels hook is asked to fetch missing range
+ * and NotifyModelsFetched must be called once Models arrive. ViewModels of missing Models are not returned by GetViewModel.
+ *
+ * Materialized ViewModels are referenced by the collection, so they are not garbage collected
+ */
+template <typename TViewModel>
+class TVirtualViewModelCollection : public FGCObject
+{
+    static_assert(TIsDerivedFrom<TViewModel, UBaseViewModel>::Value, "TViewModel must be derived from UBaseViewModel");
+
+public:
+    using FFactory = TFunction<TViewModel* ()>;
+    using FSetter = TFunction<bool (TViewModel* ViewModel, int32 ModelIndex)>;
+    using FFetchModels = TFunction<void (int32 FirstIndex, int32 Count)>;
+
+    UE_NONCOPYABLE(TVirtualViewModelCollection);
+
+    /* Creates collection that creates ViewModels via NewObject<TViewModel>() */
+    explicit TVirtualViewModelCollection(FSetter InSetter)
+        : TVirtualViewModelCollection(MoveTemp(InSetter), [] { return NewObject<TViewModel>(); })
+    {
+    }
+
+    TVirtualViewModelCollection(FSetter InSetter, FFactory InFactory)
+        : Factory(MoveTemp(InFactory))
+        , Setter(MoveTemp(InSetter))
+    {
+        check(Factory);
+        check(Setter);
+    }
+
+    /* Sets hook used to fetch Models asynchronously */
+    void SetFetchModels(FFetchModels InFetchModels)
+    {
+        FetchModels = MoveTemp(InFetchModels);
+    }
+
+    /* Sets number of Models materialized before and after requested range */
+    void SetPrefetchMargin(int32 InPrefetchMargin)
+    {
+        check(InPrefetchMargin >= 0);
+        PrefetchMargin = InPrefetchMargin;
+        UpdateWindow();
+    }
+
+    /* Returns total number of Models */
+    int32 Num() const
+    {
+        return NumModels;
+    }
+
+    /* Sets total number of Models. Already materialized ViewModels are assigned their Models again */
+    void SetNum(int32 InNumModels)
+    {
+        check(InNumModels >= 0);
+        NumModels = InNumModels;
+        RequestedModels.Init(false, NumModels);
+
+        Refresh();
+    }
+
+    /* Sets range of Models displayed by the list. ViewModels are materialized for this range and prefetch margins */
+    void SetVisibleRange(int32 FirstIndex, int32 Count)
+    {
+        check(FirstIndex >= 0 && Count >= 0);
+        VisibleFirst = FirstIndex;
+        VisibleCount = Count;
+
+        UpdateWindow();
+    }
+
+    /* Returns ViewModel of given Model or nullptr if it is outside of materialized range or its Model is not available yet */
+    TViewModel* GetViewModel(int32 ModelIndex) const
+    {
+        if (ModelIndex < WindowFirst || ModelIndex >= WindowEnd)
+        {
+            return nullptr;
+        }
+
+        const int32 Slot = GetSlot(ModelIndex);
+        return Assigned[Slot] ? ToRawPtr(Window[Slot]) : nullptr;
+    }
+
+    /* Returns number of ViewModels currently materialized, including ones waiting for their Models */
+    int32 GetNumMaterialized() const
+    {
+        return WindowEnd - WindowFirst;
+    }
+
+    /* Assigns Models that were fetched after FetchModels request */
+    void NotifyModelsFetched(int32 FirstIndex, int32 Count)
+    {
+        const int32 First = FMath::Max(FirstIndex, WindowFirst);
+        const int32 End = FMath::Min(FirstIndex + Count, WindowEnd);
+
+        AssignModels(First, End);
+    }
+
+    /* Assigns Models to all materialized ViewModels again. Call it when Models were changed in place */
+    void Refresh()
+    {
+        if (Assigned.Num() > 0)
+        {
+            Assigned.SetRange(0, Assigned.Num(), false);
+        }
+
+        MoveWindow();
+        AssignModels(WindowFirst, WindowEnd);
+    }
+
+    //~ Begin FGCObject interface
+    void AddReferencedObjects(FReferenceCollector& Collector) override
+    {
+        Collector.AddReferencedObjects(Window);
+        Collector.AddReferencedObjects(FreeViewModels);
+    }
+
+    FString GetReferencerName() const override
+    {
+        return TEXT("TVirtualViewModelCollection");
+    }
+    //~ End FGCObject interface
+
+private:
+    void UpdateWindow()
+    {
+        if (MoveWindow())
+        {
+            AssignModels(WindowFirst, WindowEnd);
+        }
+    }
+
+    /* Moves materialized range to visible range and prefetch margins. Returns false if range was not changed */
+    bool MoveWindow()
+    {
+        const int32 NewFirst = FMath::Clamp(VisibleFirst - PrefetchMargin, 0, NumModels);
+        const int32 NewEnd = FMath::Clamp(VisibleFirst + VisibleCount + PrefetchMargin, NewFirst, NumModels);
+
+        if (NewFirst == WindowFirst && NewEnd == WindowEnd)
+        {
+            return false;
+        }
+
+        // recycle ViewModels of Models that left the range, their Models are requested again if they come back into range before being fetched
+        RecycleRange(WindowFirst, FMath::Min(WindowEnd, NewFirst));
+        RecycleRange(FMath::Max(WindowFirst, NewEnd), WindowEnd);
+
+        const int32 NewSize = NewEnd - NewFirst;
+        if (NewSize > Window.Num())
+        {
+            // range does not fit into ring anymore, kept ViewModels are moved into their slots in the bigger one
+            TArray<TObjectPtr<TViewModel>> NewWindow;
+            NewWindow.SetNum(NewSize);
+            TBitArray<> NewAssigned(false, NewSize);
+
+            for (int32 Index = FMath::Max(NewFirst, WindowFirst), End = FMath::Min(NewEnd, WindowEnd); Index < End; ++Index)
+            {
+                NewWindow[Index % NewSize] = Window[GetSlot(Index)];
+                NewAssigned[Index % NewSize] = Assigned[GetSlot(Index)];
+            }
+
+            Window = MoveTemp(NewWindow);
+            Assigned = MoveTemp(NewAssigned);
+        }
+
+        WindowFirst = NewFirst;
+        WindowEnd = NewEnd;
+
+        return true;
+    }
+
+    void RecycleRange(int32 First, int32 End)
+    {
+        for (int32 Index = First; Index < End; ++Index)
+        {
+            const int32 Slot = GetSlot(Index);
+            if (Window[Slot] != nullptr)
+            {
+                FreeViewModels.Add(Window[Slot]);
+                Window[Slot] = nullptr;
+            }
+
+            Assigned[Slot] = false;
+
+            if (RequestedModels.IsValidIndex(Index))
+            {
+                RequestedModels[Index] = false;
+            }
+        }
+    }
+
+    /* Returns index in Window of ViewModel of given Model. Valid only for Models inside materialized range */
+    int32 GetSlot(int32 ModelIndex) const
+    {
+        return ModelIndex % Window.Num();
+    }
+
+    void AssignModels(int32 First, int32 End)
+    {
+        int32 MissingFirst = MAX_int32;
+        int32 MissingEnd = INDEX_NONE;
+
+        for (int32 Index = First; Index < End; ++Index)
+        {
+            const int32 Slot = GetSlot(Index);
+            if (Assigned[Slot])
+            {
+                continue;
+            }
+
+            TObjectPtr<TViewModel>& ViewModel = Window[Slot];
+            if (ViewModel == nullptr && FreeViewModels.Num() > 0)
+            {
+#if UE_VERSION_OLDER_THAN(5,5,0)
+                ViewModel = FreeViewModels.Pop(false);
+#else
+                ViewModel = FreeViewModels.Pop(EAllowShrinking::No);
+#endif
+            }
+            else if (ViewModel == nullptr)
+            {
+                ViewModel = Factory();
+            }
+
+            Assigned[Slot] = Setter(ToRawPtr(ViewModel), Index);
+
+            if (Assigned[Slot])
+            {
+                RequestedModels[Index] = false;
+            }
+            else if (!RequestedModels[Index])
+            {
+                RequestedModels[Index] = true;
+                MissingFirst = FMath::Min(MissingFirst, Index);
+                MissingEnd = Index + 1;
+            }
+        }
+
+        if (MissingEnd != INDEX_NONE && FetchModels)
+        {
+            FetchModels(MissingFirst, MissingEnd - MissingFirst);
+        }
+    }
+
+    FFactory Factory;
+    FSetter Setter;
+    FFetchModels FetchModels;
+
+    // ring of materialized ViewModels, Model with index I is in slot I % Window.Num(), so moving the range does not move the rest.
+    // Ring only grows when materialized range becomes bigger than it
+    TArray<TObjectPtr<TViewModel>> Window;
+    TBitArray<> Assigned;
+    int32 WindowFirst = 0;
+    int32 WindowEnd = 0;
+
+    // recycled ViewModels waiting to be reused
+    TArray<TObjectPtr<TViewModel>> FreeViewModels;
+
+    // Models that were already passed into FetchModels
+    TBitArray<> RequestedModels;
+
+    int32 NumModels = 0;
+    int32 VisibleFirst = 0;
+    int32 VisibleCount = 0;
+    int32 PrefetchMargin = 0;
+};
@@ -54,8 +54,8 @@ bool UBaseViewBlueprintExtension::TryRemoveUnnecessary(UBlueprint* Blueprint)
     {
         UClass* ParentViewModelClass = UnrealMvvm_Impl::FViewRegistry::GetViewModelClass(Blueprint->ParentClass);
 
-        // our parent class defines same ViewModel, no need to keep our own extension
-        if (ParentViewModelClass == Extension->GetViewModelClass())
+        // our parent class defines same ViewModel, no need to keep our own extension unless it stores property bindings or compile settings
+        if (ParentViewModelClass == Extension->GetViewModelClass() && Extension->GetPropertyBindings().Num() == 0 && !Extension->IsSingleDispatchFunction())
         {
             Extension->SetViewModelClass(nullptr);
             Blueprint->RemoveExtension(Extension);
@@ -93,8 +93,6 @@ void UBaseViewBlueprintExtension::SetViewModelClass(UClass* InViewModelClass)
 
 TArray<FBlueprintBindingEntry> UBaseViewBlueprintExtension::CollectBlueprintBindings() const
 {
-    using namespace UnrealMvvm_Impl;
-
     TArray<FBlueprintBindingEntry> BlueprintBindings;
 
     TArray<UK2Node_ViewModelPropertyChanged*> Nodes;
@@ -102,16 +100,27 @@ TArray<FBlueprintBindingEntry> UBaseViewBlueprintExtension::CollectBlueprintBind
 
     while (Blueprint != nullptr)
     {
-        FBlueprintEditorUtils::GetAllNodesOfClass<UK2Node_ViewModelPropertyChanged>(Blueprint, Nodes);
+        CollectBoundNodes(Blueprint, ViewModelClass, Nodes);
+
+        // each Blueprint in hierarchy has its own dispatch event, its bindings are indexed in the order of nodes
+        const bool bSingleDispatch = UsesSingleDispatchFunction(Blueprint);
+        const FName DispatchFunctionName = bSingleDispatch ? MakeDispatchFunctionName(Blueprint) : NAME_None;
+        const FName DispatchBatchFunctionName = bSingleDispatch ? MakeDispatchBatchFunctionName(Blueprint) : NAME_None;
 
-        for (UK2Node_ViewModelPropertyChanged* Node : Nodes)
+        for (int32 Index = 0; Index < Nodes.Num(); ++Index)
         {
-            UEdGraphPin* ExecPin = Node->FindPin(UEdGraphSchema_K2::PN_Then);
-            if (ExecPin != nullptr && ExecPin->HasAnyConnections() && FViewModelPropertyNodeHelper::IsPropertyPathValid(Node->PropertyPath, ViewModelClass))
+            FBlueprintBindingEntry& Entry = BlueprintBindings.AddDefaulted_GetRef();
+            Entry.PropertyPath = Nodes[Index]->PropertyPath;
+
+            if (bSingleDispatch)
             {
-                FBlueprintBindingEntry& Entry = BlueprintBindings.AddDefaulted_GetRef();
-                Entry.PropertyPath = Node->PropertyPath;
-                Entry.FunctionName = Node->MakeCallbackName();
+                Entry.FunctionName = DispatchFunctionName;
+                Entry.DispatchIndex = Index;
+                Entry.BatchFunctionName = DispatchBatchFunctionName;
+            }
+            else
+            {
+                Entry.FunctionName = Nodes[Index]->MakeCallbackName();
             }
         }
 
@@ -123,6 +132,96 @@ TArray<FBlueprintBindingEntry> UBaseViewBlueprintExtension::CollectBlueprintBind
     return BlueprintBindings;
 }
 
+void UBaseViewBlueprintExtension::CollectBoundNodes(UBlueprint* Blueprint, UClass* ViewModelClass, TArray<UK2Node_ViewModelPropertyChanged*>& OutNodes)
+{
+    using namespace UnrealMvvm_Impl;
+
+    FBlueprintEditorUtils::GetAllNodesOfClass<UK2Node_ViewModelPropertyChanged>(Blueprint, OutNodes);
+
+    OutNodes.RemoveAll([&](UK2Node_ViewModelPropertyChanged* Node)
+    {
+        UEdGraphPin* ExecPin = Node->FindPin(UEdGraphSchema_K2::PN_Then);
+        return ExecPin == nullptr || !ExecPin->HasAnyConnections() || !FViewModelPropertyNodeHelper::IsPropertyPathValid(Node->PropertyPath, ViewModelClass);
+    });
+}
+
+void UBaseViewBlueprintExtension::SetSingleDispatchFunction(bool bValue)
+{
+    Modify();
+    bSingleDispatchFunction = bValue;
+}
+
+bool UBaseViewBlueprintExtension::UsesSingleDispatchFunction(UBlueprint* Blueprint)
+{
+    UBaseViewBlueprintExtension* Extension = Get(Blueprint);
+    return Extension != nullptr && Extension->IsSingleDispatchFunction();
+}
+
+FName UBaseViewBlueprintExtension::MakeDispatchFunctionName(UBlueprint* Blueprint)
+{
+    TStringBuilderWithBuffer<TCHAR, 128> Builder;
+    Builder.Append(TEXT("OnVM_Dispatch_"));
+
+    // derived classes have their own dispatch events, so name must be unique in hierarchy
+    Blueprint->GetFName().AppendString(Builder);
+
+    return FName(*Builder);
+}
+
+FName UBaseViewBlueprintExtension::MakeDispatchBatchFunctionName(UBlueprint* Blueprint)
+{
+    TStringBuilderWithBuffer<TCHAR, 128> Builder;
+    Builder.Append(TEXT("OnVM_DispatchBatch_"));
+    Blueprint->GetFName().AppendString(Builder);
+
+    return FName(*Builder);
+}
+
+void UBaseViewBlueprintExtension::AddPropertyBinding(const FPropertyBindingEntry& Entry)
+{
+    Modify();
+
+    // target property may have only one source
+    PropertyBindings.RemoveAll([&](const FPropertyBindingEntry& Existing) { return Existing.TargetPath == Entry.TargetPath; });
+    PropertyBindings.Add(Entry);
+}
+
+void UBaseViewBlueprintExtension::RemovePropertyBinding(int32 Index)
+{
+    if (PropertyBindings.IsValidIndex(Index))
+    {
+        Modify();
+        PropertyBindings.RemoveAt(Index);
+    }
+}
+
+TArray<FPropertyBindingEntry> UBaseViewBlueprintExtension::CollectPropertyBindings() const
+{
+    using namespace UnrealMvvm_Impl;
+
+    TArray<FPropertyBindingEntry> Result;
+    UBlueprint* Blueprint = GetTypedOuter<UBlueprint>();
+
+    while (Blueprint != nullptr)
+    {
+        if (UBaseViewBlueprintExtension* Extension = Get(Blueprint))
+        {
+            for (const FPropertyBindingEntry& Entry : Extension->PropertyBindings)
+            {
+                if (FViewModelPropertyNodeHelper::IsPropertyPathValid(Entry.PropertyPath, ViewModelClass))
+                {
+                    Result.Add(Entry);
+                }
+            }
+        }
+
+        UClass* SuperClass = Blueprint->GeneratedClass != nullptr ? Blueprint->GeneratedClass->GetSuperClass() : nullptr;
+        Blueprint = SuperClass != nullptr ? Cast<UBlueprint>(SuperClass->ClassGeneratedBy) : nullptr;
+    }
+
+    return Result;
+}
+
 void UBaseViewBlueprintExtension::HandleGenerateFunctionGraphs(FKismetCompilerContext* CompilerContext)
 {
     UEdGraph* Graph = CompilerContext->SpawnIntermediateFunctionGraph(FString::Printf(TEXT("RegisterViewModelClassStub_%s"), *CompilerContext->TargetClass->GetName()));
@@ -139,6 +238,21 @@ void UBaseViewBlueprintExtension::HandleGenerateFunctionGraphs(FKismetCompilerCo
     // Connect initializer node to function entry
     EntryNode->GetThenPin()->MakeLinkTo(InitNode->GetExecPin());
 
+    // function graphs are generated before event graph is expanded, so indices are ready when property changed nodes ask for them
+    DispatchIndices.Reset();
+    DispatchSwitch.Reset();
+
+    if (bSingleDispatchFunction)
+    {
+        TArray<UK2Node_ViewModelPropertyChanged*> Nodes;
+        CollectBoundNodes(GetTypedOuter<UBlueprint>(), ViewModelClass, Nodes);
+
+        for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+        {
+            DispatchIndices.Add(Nodes[Index]->MakeCallbackName(), Index);
+        }
+    }
+
     // make sure that ViewModel class association is registered
     // some nodes need to know ViewModel class of the Blueprint during compilation
     // we need to do this here for correct handling of Blueprint duplication
@@ -204,6 +318,7 @@ void UBaseViewBlueprintExtension::TryAddLegacyBindings()
         if (ViewModelDynamicBinding != nullptr)
         {
             ViewModelDynamicBinding->BlueprintBindings = BlueprintBindings;
+            FViewRegistry::InvalidateBlueprintFunctions(ViewClass);
         }
     }
 }
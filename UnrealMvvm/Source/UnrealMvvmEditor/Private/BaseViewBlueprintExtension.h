@@ -6,6 +6,8 @@
 #include "Mvvm/Impl/Binding/ViewModelDynamicBinding.h"
 #include "BaseViewBlueprintExtension.generated.h"
 
+class UK2Node_SwitchInteger;
+
 /*
  * Blueprint extension class that stores ViewModel association and creates required nodes
  */
@@ -27,13 +29,62 @@ public:
 
     TArray<FBlueprintBindingEntry> CollectBlueprintBindings() const;
 
+    /* Property bindings created in this Blueprint */
+    const TArray<FPropertyBindingEntry>& GetPropertyBindings() const { return PropertyBindings; }
+
+    /* Adds new property binding. Replaces existing binding to the same target property */
+    void AddPropertyBinding(const FPropertyBindingEntry& Entry);
+    void RemovePropertyBinding(int32 Index);
+
+    /* Returns property bindings of this Blueprint and its parents */
+    TArray<FPropertyBindingEntry> CollectPropertyBindings() const;
+
+    /* Whether Blueprint bindings of this Blueprint are compiled into single dispatch event instead of event per binding */
+    bool IsSingleDispatchFunction() const { return bSingleDispatchFunction; }
+    void SetSingleDispatchFunction(bool bValue);
+
+    /* Returns whether Blueprint is compiled with single dispatch event */
+    static bool UsesSingleDispatchFunction(UBlueprint* Blueprint);
+
+    /* Name of dispatch event of a Blueprint */
+    static FName MakeDispatchFunctionName(UBlueprint* Blueprint);
+
+    /* Name of dispatch event of a Blueprint that takes indices of several bindings at once */
+    static FName MakeDispatchBatchFunctionName(UBlueprint* Blueprint);
+
+    /* Returns index of binding with given callback name inside dispatch event, INDEX_NONE if there is no such binding. Indices are collected once per compile */
+    int32 FindDispatchIndex(FName CallbackName) const
+    {
+        const int32* Found = DispatchIndices.Find(CallbackName);
+        return Found ? *Found : INDEX_NONE;
+    }
+
+    /* Switch shared by dispatch events in current compile, nullptr if it is not spawned yet */
+    UK2Node_SwitchInteger* GetDispatchSwitch() const { return DispatchSwitch.Get(); }
+    void SetDispatchSwitch(UK2Node_SwitchInteger* InDispatchSwitch) { DispatchSwitch = InDispatchSwitch; }
+
 protected:
     void HandleGenerateFunctionGraphs(FKismetCompilerContext* CompilerContext) override;
 
 private:
+    /* Collects nodes of a Blueprint that produce Blueprint bindings, in the order of binding entries */
+    static void CollectBoundNodes(UBlueprint* Blueprint, UClass* ViewModelClass, TArray<class UK2Node_ViewModelPropertyChanged*>& OutNodes);
+
     void TryAddLegacyBindings();
     void TryRegisterViewModelClass();
 
     UPROPERTY()
     TObjectPtr<UClass> ViewModelClass;
+
+    UPROPERTY()
+    TArray<FPropertyBindingEntry> PropertyBindings;
+
+    UPROPERTY()
+    bool bSingleDispatchFunction = false;
+
+    /* Dispatch index of each bound node of this Blueprint by its callback name. Filled in HandleGenerateFunctionGraphs */
+    TMap<FName, int32> DispatchIndices;
+
+    /* Spawned by the first node expanded in current compile. Reset in HandleGenerateFunctionGraphs */
+    TWeakObjectPtr<UK2Node_SwitchInteger> DispatchSwitch;
 };
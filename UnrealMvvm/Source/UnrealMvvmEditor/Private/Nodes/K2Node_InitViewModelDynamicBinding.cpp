@@ -38,6 +38,7 @@ void UK2Node_InitViewModelDynamicBinding::RegisterDynamicBinding(UDynamicBluepri
     {
         // Collect all ViewModel property bindings into DynamicBinding object
         Binding->BlueprintBindings = Extension->CollectBlueprintBindings();
+        Binding->PropertyBindings = Extension->CollectPropertyBindings();
 
         // register View class to generate proper ViewModel property bindings
         UnrealMvvm_Impl::FViewRegistry::RegisterViewClass(Blueprint->GeneratedClass, Binding->ViewModelClass);
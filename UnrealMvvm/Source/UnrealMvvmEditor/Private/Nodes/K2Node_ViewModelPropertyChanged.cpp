@@ -4,16 +4,28 @@
 #include "Mvvm/Impl/BaseView/ViewRegistry.h"
 #include "Mvvm/MvvmStatics.h"
 #include "ViewModelClassSelectorHelper.h"
+#include "BaseViewBlueprintExtension.h"
 #include "Blueprint/UserWidget.h"
 #include "EdGraphSchema_K2.h"
 #include "KismetCompiler.h"
 #include "K2Node_CustomEvent.h"
 #include "K2Node_CallFunction.h"
+#include "K2Node_SwitchInteger.h"
+#include "K2Node_TemporaryVariable.h"
+#include "K2Node_AssignmentStatement.h"
+#include "K2Node_IfThenElse.h"
+#include "K2Node_ExecutionSequence.h"
+#include "K2Node_GetArrayItem.h"
+#include "K2Node_CallArrayFunction.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "Kismet/KismetArrayLibrary.h"
 #include "GraphEditorSettings.h"
 #include "ViewModelPropertyNodeHelper.h"
 #include "Misc/EngineVersionComparison.h"
 
 const FName UK2Node_ViewModelPropertyChanged::IsInitialPinName(TEXT("IsInitial"));
+const FName UK2Node_ViewModelPropertyChanged::BindingIndexPinName(TEXT("BindingIndex"));
+const FName UK2Node_ViewModelPropertyChanged::BindingIndicesPinName(TEXT("BindingIndices"));
 
 void UK2Node_ViewModelPropertyChanged::ExpandNode(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
 {
@@ -34,17 +46,38 @@ void UK2Node_ViewModelPropertyChanged::ExpandNode(FKismetCompilerContext& Compil
 
     const UEdGraphSchema_K2* Schema = CompilerContext.GetSchema();
 
-    // Spawn custom event node to create a function for callback
+    UBlueprint* Blueprint = GetBlueprint();
+    if (UBaseViewBlueprintExtension::UsesSingleDispatchFunction(Blueprint))
+    {
+        // all bindings of the Blueprint share one event, this node becomes a case of its switch
+        const int32 DispatchIndex = UBaseViewBlueprintExtension::Get(Blueprint)->FindDispatchIndex(MakeCallbackName());
+        check(DispatchIndex != INDEX_NONE);
+
+        UK2Node_SwitchInteger* DispatchSwitch = FindOrSpawnDispatchSwitch(CompilerContext, SourceGraph);
+
+        const FName CasePinName = *FString::FromInt(DispatchIndex);
+        while (DispatchSwitch->FindPin(CasePinName) == nullptr)
+        {
+            DispatchSwitch->AddPinToSwitchNode();
+        }
+
+        // connect "then" pin of this node to the case pin of dispatch switch
+        CompilerContext.MovePinLinksToIntermediate(*ExecPin, *DispatchSwitch->FindPinChecked(CasePinName));
+    }
+    else
+    {
+        // Spawn custom event node to create a function for callback
 #if UE_VERSION_OLDER_THAN(5,4,0)
-    UK2Node_CustomEvent* CustomEvent = CompilerContext.SpawnIntermediateEventNode<UK2Node_CustomEvent>(this, ExecPin, SourceGraph);
+        UK2Node_CustomEvent* CustomEvent = CompilerContext.SpawnIntermediateEventNode<UK2Node_CustomEvent>(this, ExecPin, SourceGraph);
 #else
-    UK2Node_CustomEvent* CustomEvent = CompilerContext.SpawnIntermediateNode<UK2Node_CustomEvent>(this, SourceGraph);
+        UK2Node_CustomEvent* CustomEvent = CompilerContext.SpawnIntermediateNode<UK2Node_CustomEvent>(this, SourceGraph);
 #endif
-    CustomEvent->CustomFunctionName = MakeCallbackName();
-    CustomEvent->AllocateDefaultPins();
+        CustomEvent->CustomFunctionName = MakeCallbackName();
+        CustomEvent->AllocateDefaultPins();
 
-    // connect "then" pin of this node to "exec" pin of CustomEvent node
-    CompilerContext.MovePinLinksToIntermediate(*ExecPin, *Schema->FindExecutionPin(*CustomEvent, EGPD_Output));
+        // connect "then" pin of this node to "exec" pin of CustomEvent node
+        CompilerContext.MovePinLinksToIntermediate(*ExecPin, *Schema->FindExecutionPin(*CustomEvent, EGPD_Output));
+    }
 
     UEdGraphPin* ValueOutPin = FindPin(PropertyPath.Last());
     UEdGraphPin* HasValueOutPin = FindPin(FViewModelPropertyNodeHelper::HasValuePinName);
@@ -113,6 +146,129 @@ void UK2Node_ViewModelPropertyChanged::ExpandNode(FKismetCompilerContext& Compil
     }
 }
 
+UK2Node_SwitchInteger* UK2Node_ViewModelPropertyChanged::FindOrSpawnDispatchSwitch(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+{
+    UBlueprint* Blueprint = GetBlueprint();
+    UBaseViewBlueprintExtension* Extension = UBaseViewBlueprintExtension::Get(Blueprint);
+
+    // dispatch events are spawned by the first expanded node, others reuse their switch
+    if (UK2Node_SwitchInteger* ExistingSwitch = Extension->GetDispatchSwitch())
+    {
+        return ExistingSwitch;
+    }
+
+    const UEdGraphSchema_K2* Schema = CompilerContext.GetSchema();
+
+    auto SpawnEvent = [&](FName FunctionName, FName PinName, EPinContainerType ContainerType)
+    {
+#if UE_VERSION_OLDER_THAN(5,4,0)
+        UK2Node_CustomEvent* Event = CompilerContext.SpawnIntermediateEventNode<UK2Node_CustomEvent>(this, nullptr, SourceGraph);
+#else
+        UK2Node_CustomEvent* Event = CompilerContext.SpawnIntermediateNode<UK2Node_CustomEvent>(this, SourceGraph);
+#endif
+        Event->CustomFunctionName = FunctionName;
+        Event->AllocateDefaultPins();
+
+        FEdGraphPinType PinType;
+        PinType.PinCategory = UEdGraphSchema_K2::PC_Int;
+        PinType.ContainerType = ContainerType;
+        Event->CreateUserDefinedPin(PinName, PinType, EGPD_Output, false);
+
+        return Event;
+    };
+
+    auto SpawnVariable = [&]()
+    {
+        UK2Node_TemporaryVariable* Variable = CompilerContext.SpawnIntermediateNode<UK2Node_TemporaryVariable>(this, SourceGraph);
+        Variable->VariableType.PinCategory = UEdGraphSchema_K2::PC_Int;
+        Variable->AllocateDefaultPins();
+
+        return Variable->GetVariablePin();
+    };
+
+    auto SpawnAssignment = [&](UEdGraphPin* VariablePin, UEdGraphPin* ValuePin)
+    {
+        UK2Node_AssignmentStatement* Assignment = CompilerContext.SpawnIntermediateNode<UK2Node_AssignmentStatement>(this, SourceGraph);
+        Assignment->AllocateDefaultPins();
+        Schema->TryCreateConnection(VariablePin, Assignment->GetVariablePin());
+        Schema->TryCreateConnection(ValuePin, Assignment->GetValuePin());
+
+        return Assignment;
+    };
+
+    auto SpawnMathCall = [&](FName FunctionName, UEdGraphPin* APin)
+    {
+        UK2Node_CallFunction* Call = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
+        Call->FunctionReference.SetExternalMember(FunctionName, UKismetMathLibrary::StaticClass());
+        Call->AllocateDefaultPins();
+        Schema->TryCreateConnection(APin, Call->FindPinChecked(TEXT("A")));
+
+        return Call;
+    };
+
+    // both events write index of binding into this variable, so they share one switch
+    UEdGraphPin* IndexVariablePin = SpawnVariable();
+
+    UK2Node_SwitchInteger* DispatchSwitch = CompilerContext.SpawnIntermediateNode<UK2Node_SwitchInteger>(this, SourceGraph);
+    DispatchSwitch->AllocateDefaultPins();
+    Schema->TryCreateConnection(IndexVariablePin, DispatchSwitch->GetSelectionPin());
+
+    // dispatch event handles single change: Index = BindingIndex -> Switch
+    UK2Node_CustomEvent* DispatchEvent = SpawnEvent(UBaseViewBlueprintExtension::MakeDispatchFunctionName(Blueprint), BindingIndexPinName, EPinContainerType::None);
+    UK2Node_AssignmentStatement* AssignIndex = SpawnAssignment(IndexVariablePin, DispatchEvent->FindPinChecked(BindingIndexPinName));
+    Schema->TryCreateConnection(Schema->FindExecutionPin(*DispatchEvent, EGPD_Output), AssignIndex->GetExecPin());
+    Schema->TryCreateConnection(AssignIndex->GetThenPin(), DispatchSwitch->GetExecPin());
+
+    // batch event handles initialization of View, it loops over all changed bindings:
+    // Counter = 0 -> while (Counter < Length(BindingIndices)) { Index = BindingIndices[Counter] -> Switch; Counter = Counter + 1 }
+    UK2Node_CustomEvent* BatchEvent = SpawnEvent(UBaseViewBlueprintExtension::MakeDispatchBatchFunctionName(Blueprint), BindingIndicesPinName, EPinContainerType::Array);
+    UEdGraphPin* IndicesPin = BatchEvent->FindPinChecked(BindingIndicesPinName);
+    UEdGraphPin* CounterPin = SpawnVariable();
+
+    UK2Node_AssignmentStatement* InitCounter = CompilerContext.SpawnIntermediateNode<UK2Node_AssignmentStatement>(this, SourceGraph);
+    InitCounter->AllocateDefaultPins();
+    Schema->TryCreateConnection(CounterPin, InitCounter->GetVariablePin());
+    InitCounter->GetValuePin()->DefaultValue = TEXT("0");
+    Schema->TryCreateConnection(Schema->FindExecutionPin(*BatchEvent, EGPD_Output), InitCounter->GetExecPin());
+
+    UK2Node_CallArrayFunction* LengthCall = CompilerContext.SpawnIntermediateNode<UK2Node_CallArrayFunction>(this, SourceGraph);
+    LengthCall->FunctionReference.SetExternalMember(GET_FUNCTION_NAME_CHECKED(UKismetArrayLibrary, Array_Length), UKismetArrayLibrary::StaticClass());
+    LengthCall->AllocateDefaultPins();
+    Schema->TryCreateConnection(IndicesPin, LengthCall->GetTargetArrayPin());
+
+    UK2Node_CallFunction* LessCall = SpawnMathCall(GET_FUNCTION_NAME_CHECKED(UKismetMathLibrary, Less_IntInt), CounterPin);
+    Schema->TryCreateConnection(LengthCall->GetReturnValuePin(), LessCall->FindPinChecked(TEXT("B")));
+
+    UK2Node_IfThenElse* Branch = CompilerContext.SpawnIntermediateNode<UK2Node_IfThenElse>(this, SourceGraph);
+    Branch->AllocateDefaultPins();
+    Schema->TryCreateConnection(LessCall->GetReturnValuePin(), Branch->GetConditionPin());
+    Schema->TryCreateConnection(InitCounter->GetThenPin(), Branch->GetExecPin());
+
+    UK2Node_ExecutionSequence* Sequence = CompilerContext.SpawnIntermediateNode<UK2Node_ExecutionSequence>(this, SourceGraph);
+    Sequence->AllocateDefaultPins();
+    Schema->TryCreateConnection(Branch->GetThenPin(), Sequence->GetExecPin());
+
+    // first output of sequence runs the case of current binding, second one continues the loop after it
+    UK2Node_GetArrayItem* GetIndex = CompilerContext.SpawnIntermediateNode<UK2Node_GetArrayItem>(this, SourceGraph);
+    GetIndex->AllocateDefaultPins();
+    Schema->TryCreateConnection(IndicesPin, GetIndex->GetTargetArrayPin());
+    Schema->TryCreateConnection(CounterPin, GetIndex->GetIndexPin());
+
+    UK2Node_AssignmentStatement* AssignBatchIndex = SpawnAssignment(IndexVariablePin, GetIndex->GetResultPin());
+    Schema->TryCreateConnection(Sequence->GetThenPinGivenIndex(0), AssignBatchIndex->GetExecPin());
+    Schema->TryCreateConnection(AssignBatchIndex->GetThenPin(), DispatchSwitch->GetExecPin());
+
+    UK2Node_CallFunction* AddCall = SpawnMathCall(GET_FUNCTION_NAME_CHECKED(UKismetMathLibrary, Add_IntInt), CounterPin);
+    AddCall->FindPinChecked(TEXT("B"))->DefaultValue = TEXT("1");
+
+    UK2Node_AssignmentStatement* IncrementCounter = SpawnAssignment(CounterPin, AddCall->GetReturnValuePin());
+    Schema->TryCreateConnection(Sequence->GetThenPinGivenIndex(1), IncrementCounter->GetExecPin());
+    Schema->TryCreateConnection(IncrementCounter->GetThenPin(), Branch->GetExecPin());
+
+    Extension->SetDispatchSwitch(DispatchSwitch);
+    return DispatchSwitch;
+}
+
 void UK2Node_ViewModelPropertyChanged::AllocateDefaultPins()
 {
     CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Exec, UEdGraphSchema_K2::PN_Then);
@@ -5,6 +5,8 @@
 #include "K2Node_CachedTexts.h"
 #include "K2Node_ViewModelPropertyChanged.generated.h"
 
+class UK2Node_SwitchInteger;
+
 UCLASS()
 class UK2Node_ViewModelPropertyChanged : public UK2Node_CachedTexts
 {
@@ -42,7 +44,12 @@ protected:
     FText GetTooltipTextForCache() const override;
 
 private:
+    /* Returns switch shared by all bindings of the Blueprint, spawns dispatch events that lead to it on first call. See UBaseViewBlueprintExtension::IsSingleDispatchFunction */
+    UK2Node_SwitchInteger* FindOrSpawnDispatchSwitch(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph);
+
     static const FName IsInitialPinName;
+    static const FName BindingIndexPinName;
+    static const FName BindingIndicesPinName;
 
     /* Legacy Property name that this node is associated with */
     UPROPERTY()
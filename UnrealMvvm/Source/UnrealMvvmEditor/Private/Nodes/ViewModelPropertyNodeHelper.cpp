@@ -4,6 +4,9 @@
 #include "Mvvm/Impl/Property/ViewModelPropertyIterator.h"
 #include "ViewModelClassSelectorHelper.h"
 #include "Mvvm/MvvmStatics.h"
+#include "Mvvm/Impl/Binding/ViewModelDynamicBinding.h"
+#include "Mvvm/Impl/BaseView/BaseViewComponentImpl.h"
+#include "Misc/EngineVersionComparison.h"
 #include "Blueprint/UserWidget.h"
 #include "KismetCompiler.h"
 #include "Kismet2/BlueprintEditorUtils.h"
@@ -307,3 +310,94 @@ bool FViewModelPropertyNodeHelper::IsPropertyPathValid(TArrayView<const FName> P
 
     return bResult;
 }
+
+bool FViewModelPropertyNodeHelper::CanBindToProperty(const UnrealMvvm_Impl::FViewModelPropertyReflection& Source, const FProperty* Target, EPropertyBindingConversion& OutConversion)
+{
+    using namespace UnrealMvvm_Impl;
+
+    if (!IsPropertyAvailableInBlueprint(Source) || !Source.Flags.HasPublicGetter || Source.ContainerType != EPinContainerType::None || Target->ArrayDim != 1)
+    {
+        return false;
+    }
+
+    // target must be writable from Blueprint, either directly or via setter
+#if UE_VERSION_OLDER_THAN(5,1,0)
+    const bool bHasSetter = false;
+#else
+    const bool bHasSetter = Target->HasSetter();
+#endif
+    if (!Target->HasAnyPropertyFlags(CPF_BlueprintVisible) || (Target->HasAnyPropertyFlags(CPF_BlueprintReadOnly) && !bHasSetter))
+    {
+        return false;
+    }
+
+    // common conversions are performed natively, see MvvmConverters
+    if (Source.PinCategoryType == EPinCategoryType::Boolean && FDirectPropertyChangeHandler::IsVisibilityProperty(Target))
+    {
+        OutConversion = EPropertyBindingConversion::BoolToVisibility;
+        return true;
+    }
+
+    if (Target->IsA<FTextProperty>() && (Source.PinCategoryType == EPinCategoryType::Float || Source.PinCategoryType == EPinCategoryType::Double))
+    {
+        OutConversion = Source.PinCategoryType == EPinCategoryType::Float ? EPropertyBindingConversion::FloatToPercentText : EPropertyBindingConversion::DoubleToPercentText;
+        return true;
+    }
+
+    if (Target->IsA<FBoolProperty>())
+    {
+        OutConversion = EPropertyBindingConversion::FromBool;
+        return Source.PinCategoryType == EPinCategoryType::Boolean;
+    }
+
+    const FNumericProperty* NumericTarget = CastField<FNumericProperty>(Target);
+    if (NumericTarget != nullptr && !NumericTarget->IsEnum())
+    {
+        switch (Source.PinCategoryType)
+        {
+        case EPinCategoryType::Byte:
+            OutConversion = EPropertyBindingConversion::FromByte;
+            return true;
+        case EPinCategoryType::Int:
+            OutConversion = EPropertyBindingConversion::FromInt;
+            return true;
+        case EPinCategoryType::Int64:
+            OutConversion = EPropertyBindingConversion::FromInt64;
+            return true;
+        case EPinCategoryType::Float:
+            OutConversion = EPropertyBindingConversion::FromFloat;
+            return true;
+        case EPinCategoryType::Double:
+            OutConversion = EPropertyBindingConversion::FromDouble;
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // everything else is copied as is, so both properties must have the same type
+    FEdGraphPinType SourcePinType;
+    FEdGraphPinType TargetPinType;
+    if (!FillPinType(SourcePinType, &Source) || !GetDefault<UEdGraphSchema_K2>()->ConvertPropertyToPinType(Target, TargetPinType))
+    {
+        return false;
+    }
+
+    if (SourcePinType.PinCategory != TargetPinType.PinCategory || SourcePinType.PinSubCategory != TargetPinType.PinSubCategory)
+    {
+        return false;
+    }
+
+    OutConversion = EPropertyBindingConversion::None;
+
+    if (SourcePinType.PinCategory == UEdGraphSchema_K2::PC_Object)
+    {
+        // object pointer may be assigned to a property of base class
+        const UClass* SourceClass = Cast<UClass>(SourcePinType.PinSubCategoryObject.Get());
+        const UClass* TargetClass = Cast<UClass>(TargetPinType.PinSubCategoryObject.Get());
+
+        return SourceClass != nullptr && TargetClass != nullptr && SourceClass->IsChildOf(TargetClass);
+    }
+
+    return SourcePinType.PinSubCategoryObject == TargetPinType.PinSubCategoryObject;
+}
@@ -12,6 +12,8 @@ class FKismetCompilerContext;
 class UEdGraphNode;
 class UEdGraph;
 class UK2Node_CallFunction;
+class FProperty;
+enum class EPropertyBindingConversion : uint8;
 
 /* Helper class that is used across different ViewModel related custom nodes*/
 class FViewModelPropertyNodeHelper
@@ -46,6 +48,9 @@ public:
     /* Checks whether provided PropertyPath is valid in context of given ViewModel class*/
     static bool IsPropertyPathValid(TArrayView<const FName> PropertyPath, UClass* ViewModelClass);
 
+    /* Returns whether value of ViewModel property may be written directly into target property and how it should be converted */
+    static bool CanBindToProperty(const UnrealMvvm_Impl::FViewModelPropertyReflection& Source, const FProperty* Target, EPropertyBindingConversion& OutConversion);
+
     /* Pin Name for HasValue */
     static const FName HasValuePinName;
 
@@ -21,11 +21,14 @@
 #include "Widgets/Images/SLayeredImage.h"
 #include "Styling/StyleColors.h"
 #include "ScopedTransaction.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/Input/SCheckBox.h"
 
 void SViewModelPropertiesPanel::Construct(const FArguments& InArgs, TSharedPtr<FBlueprintEditor> Editor)
 {
     WeakBlueprintEditor = Editor;
     Blueprint = Editor->GetBlueprintObj();
+    PropertyBindingsBox = SNew(SVerticalBox);
 
     Blueprint->OnChanged().AddSP(this, &ThisClass::OnBlueprintChanged);
 
@@ -49,7 +52,13 @@ void SViewModelPropertiesPanel::Construct(const FArguments& InArgs, TSharedPtr<F
         + SVerticalBox::Slot()
         .AutoHeight()
         [
-            MakeAddBindingButton()
+            MakeAddBindingButtons()
+        ]
+
+        + SVerticalBox::Slot()
+        .AutoHeight()
+        [
+            PropertyBindingsBox.ToSharedRef()
         ]
 
         + SVerticalBox::Slot()
@@ -141,15 +150,50 @@ TSharedRef<SWidget> SViewModelPropertiesPanel::MakeViewModelSelector()
     ];
 }
 
-TSharedRef<SWidget> SViewModelPropertiesPanel::MakeAddBindingButton()
+TSharedRef<SWidget> SViewModelPropertiesPanel::MakeAddBindingButtons()
 {
     return SNew(SBox)
     .HAlign(HAlign_Left)
     .VAlign(VAlign_Center)
     .Padding(8, 0, 20, 4)
     [
-        SNew(SComboButton)
-        .OnGetMenuContent(this, &ThisClass::MakeAddBindingPopup)
+        SNew(SHorizontalBox)
+
+        + SHorizontalBox::Slot()
+        .AutoWidth()
+        .Padding(0, 0, 4, 0)
+        [
+            MakeAddBindingButton(NSLOCTEXT("UnrealMvvm", "AddViewModelBinding", "Add Binding"), FOnGetContent::CreateSP(this, &ThisClass::MakeAddBindingPopup))
+        ]
+
+        + SHorizontalBox::Slot()
+        .AutoWidth()
+        [
+            MakeAddBindingButton(NSLOCTEXT("UnrealMvvm", "AddViewModelPropertyBinding", "Add Property Binding"), FOnGetContent::CreateSP(this, &ThisClass::MakeAddPropertyBindingPopup))
+        ]
+
+        + SHorizontalBox::Slot()
+        .AutoWidth()
+        .VAlign(VAlign_Center)
+        .Padding(12, 0, 0, 0)
+        [
+            SNew(SCheckBox)
+            .IsChecked(this, &ThisClass::GetSingleDispatchState)
+            .OnCheckStateChanged(this, &ThisClass::OnSingleDispatchChanged)
+            .IsEnabled_Lambda([this]() { return ViewModelClass != nullptr; })
+            .ToolTipText(NSLOCTEXT("UnrealMvvm", "SingleDispatchFunction.Tooltip", "Compile all bindings of this Blueprint into single dispatch event instead of event per binding"))
+            [
+                SNew(STextBlock)
+                .Text(NSLOCTEXT("UnrealMvvm", "SingleDispatchFunction", "Single Dispatch"))
+            ]
+        ]
+    ];
+}
+
+TSharedRef<SWidget> SViewModelPropertiesPanel::MakeAddBindingButton(const FText& Label, FOnGetContent OnGetMenuContent)
+{
+    return SNew(SComboButton)
+        .OnGetMenuContent(OnGetMenuContent)
         .ButtonStyle(&FAppStyle::Get().GetWidgetStyle<FButtonStyle>("Button"))
         .HasDownArrow(false)
         .ContentPadding(FMargin(4, 2))
@@ -173,10 +217,9 @@ TSharedRef<SWidget> SViewModelPropertiesPanel::MakeAddBindingButton()
             .AutoWidth()
             [
                 SNew(STextBlock)
-                .Text(NSLOCTEXT("UnrealMvvm", "AddViewModelBinding", "Add Binding"))
+                .Text(Label)
             ]
-        ]
-    ];
+        ];
 }
 
 TSharedRef<SWidget> SViewModelPropertiesPanel::MakeAddBindingPopup()
@@ -242,6 +285,90 @@ void SViewModelPropertiesPanel::MakeAddBindingMenu(FMenuBuilder& Builder, UClass
     Builder.EndSection();
 }
 
+TSharedRef<SWidget> SViewModelPropertiesPanel::MakeAddPropertyBindingPopup()
+{
+    FMenuBuilder Builder(true, nullptr, nullptr, false, &FCoreStyle::Get(), true, NAME_None, false);
+
+    MakeAddPropertyBindingMenu(Builder, ViewModelClass, {});
+
+    return Builder.MakeWidget();
+}
+
+void SViewModelPropertiesPanel::MakeAddPropertyBindingMenu(FMenuBuilder& Builder, UClass* InViewModelClass, TArray<FName> InPropertyPath)
+{
+    using namespace UnrealMvvm_Impl;
+
+    Builder.BeginSection(NAME_None, InViewModelClass->GetDisplayNameText());
+
+    for (FViewModelPropertyIterator It(InViewModelClass, true); It; ++It)
+    {
+        TArray<FName> NewPropertyPath = InPropertyPath;
+        NewPropertyPath.Add(It->GetProperty()->GetName());
+
+        UClass* ValueClass = Cast<UClass>(It->GetPinSubCategoryObject());
+        if (It->ContainerType == EPinContainerType::None && ValueClass != nullptr && ValueClass->IsChildOf<UBaseViewModel>())
+        {
+            Builder.AddSubMenu(
+                MakeContextMenuEntryWidget(*It),
+                FNewMenuDelegate::CreateSP(this, &ThisClass::MakeAddPropertyBindingMenu, ValueClass, NewPropertyPath)
+            );
+        }
+        else
+        {
+            // properties of the View are listed in a sub menu, only compatible ones are shown
+            Builder.AddSubMenu(
+                MakeContextMenuEntryWidget(*It),
+                FNewMenuDelegate::CreateSP(this, &ThisClass::MakeTargetPropertyMenu, NewPropertyPath, &*It, TArray<FName>(), (UStruct*)Blueprint->SkeletonGeneratedClass)
+            );
+        }
+    }
+
+    Builder.EndSection();
+}
+
+void SViewModelPropertiesPanel::MakeTargetPropertyMenu(FMenuBuilder& Builder, TArray<FName> InPropertyPath, const UnrealMvvm_Impl::FViewModelPropertyReflection* Source, TArray<FName> InTargetPath, UStruct* TargetStruct)
+{
+    if (TargetStruct == nullptr)
+    {
+        return;
+    }
+
+    for (TFieldIterator<FProperty> It(TargetStruct); It; ++It)
+    {
+        FProperty* Property = *It;
+
+        TArray<FName> NewTargetPath = InTargetPath;
+        NewTargetPath.Add(Property->GetFName());
+
+        EPropertyBindingConversion Conversion;
+        if (FViewModelPropertyNodeHelper::CanBindToProperty(*Source, Property, Conversion))
+        {
+            const bool bPercent = Conversion == EPropertyBindingConversion::FloatToPercentText || Conversion == EPropertyBindingConversion::DoubleToPercentText;
+
+            Builder.AddMenuEntry(
+                bPercent ? FText::Format(NSLOCTEXT("UnrealMvvm", "PercentTextTarget", "{0} (as Percent)"), Property->GetDisplayNameText()) : Property->GetDisplayNameText(),
+                Property->GetToolTipText(),
+                FSlateIcon(),
+                FUIAction(
+                    FExecuteAction::CreateSP(this, &ThisClass::HandleAddPropertyBinding, InPropertyPath, NewTargetPath, Conversion)
+                )
+            );
+        }
+        else if (InTargetPath.IsEmpty() && Property->HasAnyPropertyFlags(CPF_BlueprintVisible))
+        {
+            // go one level deeper to bind properties of widgets and other objects referenced by View
+            if (FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property))
+            {
+                Builder.AddSubMenu(
+                    Property->GetDisplayNameText(),
+                    Property->GetToolTipText(),
+                    FNewMenuDelegate::CreateSP(this, &ThisClass::MakeTargetPropertyMenu, InPropertyPath, Source, NewTargetPath, (UStruct*)ObjectProperty->PropertyClass)
+                );
+            }
+        }
+    }
+}
+
 TSharedRef<SWidget> SViewModelPropertiesPanel::MakeContextMenuEntryWidget(const UnrealMvvm_Impl::FViewModelPropertyReflection& Reflection)
 {
     using namespace UnrealMvvm_Impl;
@@ -319,6 +446,63 @@ void SViewModelPropertiesPanel::RegenerateBindings()
 {
     BindingNodes.Reset();
     FBlueprintEditorUtils::GetAllNodesOfClass<UK2Node_ViewModelPropertyChanged>(Blueprint.Get(), BindingNodes);
+
+    RegeneratePropertyBindings();
+}
+
+void SViewModelPropertiesPanel::RegeneratePropertyBindings()
+{
+    PropertyBindingsBox->ClearChildren();
+
+    UBaseViewBlueprintExtension* Extension = UBaseViewBlueprintExtension::Get(Blueprint.Get());
+    if (Extension == nullptr)
+    {
+        return;
+    }
+
+    auto JoinPath = [](const TArray<FName>& Path)
+    {
+        return FString::JoinBy(Path, TEXT("."), [](const FName& Name) { return Name.ToString(); });
+    };
+
+    const TArray<FPropertyBindingEntry>& PropertyBindings = Extension->GetPropertyBindings();
+    for (int32 Index = 0; Index < PropertyBindings.Num(); ++Index)
+    {
+        const FPropertyBindingEntry& Entry = PropertyBindings[Index];
+
+        PropertyBindingsBox->AddSlot()
+        .AutoHeight()
+        [
+            SNew(SBorder)
+            .BorderImage(FAppStyle::Get().GetBrush("DetailsView.GridLine"))
+            .Padding(0, 0, 0, 1)
+            [
+                SNew(SBorder)
+                .BorderImage(FAppStyle::Get().GetBrush("DetailsView.CategoryMiddle"))
+                .BorderBackgroundColor(FAppStyle::Get().GetSlateColor("Colors.Panel"))
+                .Padding(8, 4, 20, 4)
+                [
+                    SNew(SHorizontalBox)
+
+                    + SHorizontalBox::Slot()
+                    .FillWidth(1)
+                    .VAlign(VAlign_Center)
+                    [
+                        SNew(STextBlock)
+                        .Text(FText::FromString(FString::Printf(TEXT("%s -> %s"), *JoinPath(Entry.PropertyPath), *JoinPath(Entry.TargetPath))))
+                        .OverflowPolicy(ETextOverflowPolicy::Ellipsis)
+                    ]
+
+                    + SHorizontalBox::Slot()
+                    .AutoWidth()
+                    .VAlign(VAlign_Center)
+                    [
+                        PropertyCustomizationHelpers::MakeDeleteButton(FSimpleDelegate::CreateSP(this, &ThisClass::HandleRemovePropertyBinding, Index))
+                    ]
+                ]
+            ]
+        ];
+    }
 }
 
 void SViewModelPropertiesPanel::CacheViewModelClass(bool bMayRemoveExtension)
@@ -447,6 +631,61 @@ void SViewModelPropertiesPanel::HandleRemoveBinding(UK2Node_ViewModelPropertyCha
     FBlueprintEditorUtils::RemoveNode(Blueprint.Get(), Node);
 }
 
+void SViewModelPropertiesPanel::HandleAddPropertyBinding(TArray<FName> InPropertyPath, TArray<FName> InTargetPath, EPropertyBindingConversion Conversion)
+{
+    const FScopedTransaction Transaction(INVTEXT("Add property binding"));
+
+    UBaseViewBlueprintExtension* Extension = UBaseViewBlueprintExtension::Request(Blueprint.Get());
+    if (Extension->GetViewModelClass() == nullptr)
+    {
+        // ViewModel class is inherited from parent, but bindings are stored in our own extension
+        Extension->SetViewModelClass(ViewModelClass);
+    }
+
+    FPropertyBindingEntry Entry;
+    Entry.PropertyPath = MoveTemp(InPropertyPath);
+    Entry.TargetPath = MoveTemp(InTargetPath);
+    Entry.Conversion = Conversion;
+    Extension->AddPropertyBinding(Entry);
+
+    FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint.Get());
+    RegeneratePropertyBindings();
+}
+
+void SViewModelPropertiesPanel::HandleRemovePropertyBinding(int32 Index)
+{
+    const FScopedTransaction Transaction(INVTEXT("Remove property binding"));
+
+    if (UBaseViewBlueprintExtension* Extension = UBaseViewBlueprintExtension::Get(Blueprint.Get()))
+    {
+        Extension->RemovePropertyBinding(Index);
+        FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint.Get());
+        RegeneratePropertyBindings();
+    }
+}
+
+ECheckBoxState SViewModelPropertiesPanel::GetSingleDispatchState() const
+{
+    return UBaseViewBlueprintExtension::UsesSingleDispatchFunction(Blueprint.Get()) ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void SViewModelPropertiesPanel::OnSingleDispatchChanged(ECheckBoxState NewState)
+{
+    const FScopedTransaction Transaction(INVTEXT("Change binding dispatch"));
+
+    UBaseViewBlueprintExtension* Extension = UBaseViewBlueprintExtension::Request(Blueprint.Get());
+    if (Extension->GetViewModelClass() == nullptr)
+    {
+        // ViewModel class is inherited from parent, but setting is stored in our own extension
+        Extension->SetViewModelClass(ViewModelClass);
+    }
+
+    Extension->SetSingleDispatchFunction(NewState == ECheckBoxState::Checked);
+
+    // changes set of generated functions
+    FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint.Get());
+}
+
 UK2Node_ViewModelPropertyChanged* SViewModelPropertiesPanel::FindEventNode(const TArray<FName>& InPropertyPath) const
 {
     TArray<UK2Node_ViewModelPropertyChanged*> EventNodes;
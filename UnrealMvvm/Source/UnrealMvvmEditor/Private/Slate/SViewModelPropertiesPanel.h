@@ -12,6 +12,8 @@ class FViewModelPropertyBase;
 class SViewModelPropertyRow;
 class UK2Node_ViewModelPropertyChanged;
 class FDetailColumnSizeData;
+class SVerticalBox;
+enum class EPropertyBindingConversion : uint8;
 
 namespace UnrealMvvm_Impl
 {
@@ -31,9 +33,13 @@ public:
 
 private:
     TSharedRef<SWidget> MakeViewModelSelector();
-    TSharedRef<SWidget> MakeAddBindingButton();
+    TSharedRef<SWidget> MakeAddBindingButtons();
+    TSharedRef<SWidget> MakeAddBindingButton(const FText& Label, FOnGetContent OnGetMenuContent);
     TSharedRef<SWidget> MakeAddBindingPopup();
     void MakeAddBindingMenu(FMenuBuilder& Builder, UClass* ViewModelClass, TArray<FName> InPropertyPath);
+    TSharedRef<SWidget> MakeAddPropertyBindingPopup();
+    void MakeAddPropertyBindingMenu(FMenuBuilder& Builder, UClass* ViewModelClass, TArray<FName> InPropertyPath);
+    void MakeTargetPropertyMenu(FMenuBuilder& Builder, TArray<FName> InPropertyPath, const UnrealMvvm_Impl::FViewModelPropertyReflection* Source, TArray<FName> InTargetPath, UStruct* TargetStruct);
     TSharedRef<SWidget> MakeContextMenuEntryWidget(const UnrealMvvm_Impl::FViewModelPropertyReflection& Reflection);
 
     TSharedRef<ITableRow> MakeBindingRow(UK2Node_ViewModelPropertyChanged* Node, const TSharedRef<STableViewBase>& OwnerTable);
@@ -41,6 +47,7 @@ private:
     TSharedRef<SWidget> MakeViewModelClassSelector();
 
     void RegenerateBindings();
+    void RegeneratePropertyBindings();
     void CacheViewModelClass(bool bMayRemoveExtension);
     void OnViewClassChanged(UClass* ViewClass, UClass* ViewModelClass);
     void OnBlueprintChanged(UBlueprint*);
@@ -58,6 +65,11 @@ private:
 
     void HandleAddBinding(TArray<FName> InPropertyPath);
     void HandleRemoveBinding(UK2Node_ViewModelPropertyChanged* Node);
+    void HandleAddPropertyBinding(TArray<FName> InPropertyPath, TArray<FName> InTargetPath, EPropertyBindingConversion Conversion);
+    void HandleRemovePropertyBinding(int32 Index);
+
+    ECheckBoxState GetSingleDispatchState() const;
+    void OnSingleDispatchChanged(ECheckBoxState NewState);
 
     UK2Node_ViewModelPropertyChanged* FindEventNode(const TArray<FName>& InPropertyPath) const;
 
@@ -71,6 +83,9 @@ private:
     TSharedPtr<SBindingListView> BindingList;
     TArray<UK2Node_ViewModelPropertyChanged*> BindingNodes;
 
+    /* Property bindings are few, so they are shown in a simple box above the list of event bindings */
+    TSharedPtr<SVerticalBox> PropertyBindingsBox;
+
     SHorizontalBox::FSlot* ClassSelectorSlot = nullptr;
 };
 
@@ -84,6 +84,7 @@ public:
         if (GEditor)
         {
             GEditor->OnBlueprintPreCompile().RemoveAll(this);
+            GEditor->OnBlueprintCompiled().RemoveAll(this);
         }
     }
 
@@ -196,6 +197,7 @@ private:
         if (GEditor != nullptr)
         {
             GEditor->OnBlueprintPreCompile().AddRaw(this, &ThisClass::OnBlueprintPreCompile);
+            GEditor->OnBlueprintCompiled().AddRaw(this, &ThisClass::OnBlueprintCompiled);
         }
         else
         {
@@ -239,6 +241,13 @@ private:
         }
     }
 
+    void OnBlueprintCompiled()
+    {
+        // compilation recreates functions of all affected classes, including dependent ones
+        // the event does not tell which classes were compiled, so drop all resolved functions
+        UnrealMvvm_Impl::FViewRegistry::InvalidateBlueprintFunctions(nullptr);
+    }
+
     void OnKismetPreCompile()
     {
         for (TWeakObjectPtr<UBlueprint> Blueprint : PendingBlueprints)
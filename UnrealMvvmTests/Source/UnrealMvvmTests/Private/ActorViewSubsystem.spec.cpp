@@ -0,0 +1,147 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UObject/StrongObjectPtr.h"
+
+#include "TestBaseActorView.h"
+#include "TestBaseViewModel.h"
+#include "Mvvm/MvvmStatics.h"
+#include "Mvvm/Impl/BaseView/ActorViewSubsystem.h"
+#include "Mvvm/Impl/BaseView/BaseViewComponent.h"
+
+#include "TempWorldHelper.h"
+
+BEGIN_DEFINE_SPEC(FActorViewSubsystemSpec, "UnrealMvvm.BaseActorView.Subsystem", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FActorViewSubsystemSpec)
+
+BEGIN_DEFINE_SPEC(FActorViewSubsystemBenchmarkSpec, "UnrealMvvm.BaseActorView.Subsystem.Benchmark", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::PerfFilter)
+static constexpr int32 NumActors = 2000;
+
+template <typename TActor>
+double MeasureSpawn(UWorld* World, UTestBaseViewModel* ViewModel);
+END_DEFINE_SPEC(FActorViewSubsystemBenchmarkSpec)
+
+void FActorViewSubsystemSpec::Define()
+{
+    It("Should Receive Changes Without Component", [this]
+    {
+        FTempWorldHelper Helper;
+
+        ATestBaseActorViewSubsystem* View = Helper.World->SpawnActor<ATestBaseActorViewSubsystem>();
+        UTestBaseViewModel* ViewModel = NewObject<UTestBaseViewModel>();
+        ViewModel->SetIntValue(1);
+
+        View->SetViewModel(ViewModel);
+        TestEqual("MyValue is default", View->MyValue, 0);
+
+        View->DispatchBeginPlay();
+        TestEqual("MyValue", View->MyValue, 1);
+
+        ViewModel->SetIntValue(2);
+        TestEqual("MyValue is updated", View->MyValue, 2);
+
+        TestNull("Component", View->FindComponentByClass<UBaseViewComponent>());
+        TestEqual("Num Views", Helper.World->GetSubsystem<UActorViewSubsystem>()->GetNumViews(), 1);
+    });
+
+    It("Should Stop Listening On EndPlay", [this]
+    {
+        FTempWorldHelper Helper;
+
+        ATestBaseActorViewSubsystem* View = Helper.World->SpawnActor<ATestBaseActorViewSubsystem>();
+        UTestBaseViewModel* ViewModel = NewObject<UTestBaseViewModel>();
+
+        View->DispatchBeginPlay();
+        View->SetViewModel(ViewModel);
+
+        ViewModel->SetIntValue(1);
+        TestEqual("MyValue", View->MyValue, 1);
+
+        View->RouteEndPlay(EEndPlayReason::EndPlayInEditor);
+
+        ViewModel->SetIntValue(2);
+        TestEqual("MyValue is not updated", View->MyValue, 1);
+    });
+
+    It("Should Receive Changes When ViewModel Is Set From BeginPlay", [this]
+    {
+        FTempWorldHelper Helper;
+
+        ATestBaseActorViewSubsystem* View = Helper.World->SpawnActor<ATestBaseActorViewSubsystem>();
+        UTestBaseViewModel* ViewModel = NewObject<UTestBaseViewModel>();
+        ViewModel->SetIntValue(1);
+
+        View->BeginPlayViewModel = ViewModel;
+        View->DispatchBeginPlay();
+        TestEqual("MyValue", View->MyValue, 1);
+
+        ViewModel->SetIntValue(2);
+        TestEqual("MyValue is updated", View->MyValue, 2);
+    });
+
+    It("Should Not Create Component From MvvmStatics Before BeginPlay", [this]
+    {
+        FTempWorldHelper Helper;
+
+        ATestBaseActorViewSubsystem* View = Helper.World->SpawnActor<ATestBaseActorViewSubsystem>();
+
+        UMvvmStatics::SetDiffRebindEnabledInActor(View, true);
+        UMvvmStatics::SetDiffPropagationEnabledInActor(View, true);
+        UMvvmStatics::SetViewModelToActor(View, NewObject<UTestBaseViewModel>());
+
+        TestNull("Component", View->FindComponentByClass<UBaseViewComponent>());
+        TestEqual("Num Views", Helper.World->GetSubsystem<UActorViewSubsystem>()->GetNumViews(), 1);
+    });
+
+    It("Should Access ViewModel From MvvmStatics", [this]
+    {
+        FTempWorldHelper Helper;
+
+        ATestBaseActorViewSubsystem* View = Helper.World->SpawnActor<ATestBaseActorViewSubsystem>();
+        UTestBaseViewModel* ViewModel = NewObject<UTestBaseViewModel>();
+
+        View->DispatchBeginPlay();
+        UMvvmStatics::SetViewModelToActor(View, ViewModel);
+
+        TestEqual("ViewModel", UMvvmStatics::GetViewModelFromActor(View), (UBaseViewModel*)ViewModel);
+        TestEqual("Native ViewModel", View->GetViewModel(), ViewModel);
+        TestNull("Component", View->FindComponentByClass<UBaseViewComponent>());
+    });
+}
+
+void FActorViewSubsystemBenchmarkSpec::Define()
+{
+    It("Should Compare Spawn Time Of Component And Subsystem Storage", [this]()
+    {
+        TStrongObjectPtr<UTestBaseViewModel> ViewModel{ NewObject<UTestBaseViewModel>() };
+
+        double ComponentTime = 0.0;
+        double SubsystemTime = 0.0;
+
+        {
+            FTempWorldHelper Helper;
+            ComponentTime = MeasureSpawn<ATestBaseActorViewPure>(Helper.World, ViewModel.Get());
+        }
+
+        {
+            FTempWorldHelper Helper;
+            SubsystemTime = MeasureSpawn<ATestBaseActorViewSubsystem>(Helper.World, ViewModel.Get());
+        }
+
+        AddInfo(FString::Printf(TEXT("Spawn %d Actor Views: %.3f ms with component, %.3f ms with subsystem, %.3f ms delta"), NumActors, ComponentTime, SubsystemTime, ComponentTime - SubsystemTime));
+    });
+}
+
+template <typename TActor>
+double FActorViewSubsystemBenchmarkSpec::MeasureSpawn(UWorld* World, UTestBaseViewModel* ViewModel)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < NumActors; ++Index)
+    {
+        TActor* View = World->SpawnActor<TActor>();
+        View->SetViewModel(ViewModel);
+        View->DispatchBeginPlay();
+    }
+
+    return (FPlatformTime::Seconds() - StartTime) * 1000.0;
+}
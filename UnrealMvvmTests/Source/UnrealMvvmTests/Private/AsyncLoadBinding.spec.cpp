@@ -0,0 +1,100 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "UObject/UObjectGlobals.h"
+
+#include "Mvvm/AsyncLoadBinding.h"
+#include "Mvvm/StructViewModelBinding.h"
+#include "StructTestViewModel.h"
+#include "TestBaseViewModel.h"
+
+BEGIN_DEFINE_SPEC(FAsyncLoadBindingSpec, "UnrealMvvm.AsyncLoadBinding", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+// package that does not exist is never resident, so its load always completes asynchronously and fails
+const TSoftObjectPtr<UObject> MissingObject{ FSoftObjectPath(TEXT("/Engine/UnrealMvvmTests/MissingAsset.MissingAsset")) };
+END_DEFINE_SPEC(FAsyncLoadBindingSpec)
+
+void FAsyncLoadBindingSpec::Define()
+{
+    It("Should Pass Resident Object Immediately", [this]()
+    {
+        UTestBaseViewModel* Object = NewObject<UTestBaseViewModel>();
+
+        FStructTestViewModel ViewModel;
+        ViewModel.SetSoftObjectValue(Object);
+
+        TArray<UObject*> Received;
+        TStructViewModelBinding<FStructTestViewModel> Binding;
+        BindAsyncLoad(&Binding, FStructTestViewModel::SoftObjectValueProperty(), [&](UObject* Value) { Received.Add(Value); });
+        Binding.SetViewModel(&ViewModel);
+
+        TestEqual("Calls", Received.Num(), 1);
+        TestEqual("Object", Received.Last(), (UObject*)Object);
+
+        ViewModel.SetSoftObjectValue(nullptr);
+
+        TestEqual("Calls", Received.Num(), 2);
+        TestNull("Object", Received.Last());
+
+        Binding.SetViewModel(nullptr);
+    });
+
+    It("Should Pass Result Once Deferred Load Completes", [this]()
+    {
+        FStructTestViewModel ViewModel;
+        ViewModel.SetSoftObjectValue(MissingObject);
+
+        TArray<UObject*> Received;
+        TStructViewModelBinding<FStructTestViewModel> Binding;
+        BindAsyncLoad(&Binding, FStructTestViewModel::SoftObjectValueProperty(), [&](UObject* Value) { Received.Add(Value); });
+        Binding.SetViewModel(&ViewModel);
+
+        TestEqual("Calls before load", Received.Num(), 0);
+
+        FlushAsyncLoading();
+
+        if (TestEqual("Calls after load", Received.Num(), 1))
+        {
+            TestNull("Object", Received.Last());
+        }
+
+        Binding.SetViewModel(nullptr);
+    });
+
+    It("Should Cancel Load Superseded By New Value", [this]()
+    {
+        UTestBaseViewModel* Object = NewObject<UTestBaseViewModel>();
+
+        FStructTestViewModel ViewModel;
+        ViewModel.SetSoftObjectValue(MissingObject);
+
+        TArray<UObject*> Received;
+        TStructViewModelBinding<FStructTestViewModel> Binding;
+        BindAsyncLoad(&Binding, FStructTestViewModel::SoftObjectValueProperty(), [&](UObject* Value) { Received.Add(Value); });
+        Binding.SetViewModel(&ViewModel);
+
+        ViewModel.SetSoftObjectValue(Object);
+        FlushAsyncLoading();
+
+        TestEqual("Calls", Received.Num(), 1);
+        TestEqual("Object", Received.Last(), (UObject*)Object);
+
+        Binding.SetViewModel(nullptr);
+    });
+
+    It("Should Cancel Load When Binding Is Destroyed", [this]()
+    {
+        FStructTestViewModel ViewModel;
+        ViewModel.SetSoftObjectValue(MissingObject);
+
+        TArray<UObject*> Received;
+        {
+            TStructViewModelBinding<FStructTestViewModel> Binding;
+            BindAsyncLoad(&Binding, FStructTestViewModel::SoftObjectValueProperty(), [&](UObject* Value) { Received.Add(Value); });
+            Binding.SetViewModel(&ViewModel);
+        }
+
+        FlushAsyncLoading();
+
+        TestEqual("Calls", Received.Num(), 0);
+    });
+}
@@ -0,0 +1,61 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "AsyncTestViewModel.h"
+#include "PropertyChangeCounter.h"
+
+BEGIN_DEFINE_SPEC(FAsyncViewModelValueSpec, "UnrealMvvm.AsyncViewModelValue", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FAsyncViewModelValueSpec)
+
+void FAsyncViewModelValueSpec::Define()
+{
+    It("Should Reset Value While Pending", [this]()
+    {
+        UAsyncTestViewModel* ViewModel = NewObject<UAsyncTestViewModel>();
+
+        TPromise<int32> FirstPromise;
+        ViewModel->ValueRequest.Start(ViewModel, FirstPromise.GetFuture());
+        FirstPromise.SetValue(1);
+
+        TPromise<int32> Promise;
+        ViewModel->ValueRequest.Start(ViewModel, Promise.GetFuture());
+
+        TestFalse("Has Value", ViewModel->GetValue().IsSet());
+        TestTrue("Is Pending", ViewModel->ValueRequest.IsPending());
+
+        Promise.SetValue(2);
+        TestEqual("Value", ViewModel->GetValue(), TOptional<int32>(2));
+    });
+
+    It("Should Set Value When Resolved", [this]()
+    {
+        UAsyncTestViewModel* ViewModel = NewObject<UAsyncTestViewModel>();
+
+        TPromise<int32> Promise;
+        ViewModel->ValueRequest.Start(ViewModel, Promise.GetFuture());
+
+        FPropertyChangeCounter Counter(ViewModel);
+        Promise.SetValue(5);
+
+        TestEqual("Value", ViewModel->GetValue(), TOptional<int32>(5));
+        TestEqual("Changes", Counter[UAsyncTestViewModel::ValueProperty()], 1);
+        TestFalse("Is Pending", ViewModel->ValueRequest.IsPending());
+    });
+
+    It("Should Drop Result When Cancelled", [this]()
+    {
+        UAsyncTestViewModel* ViewModel = NewObject<UAsyncTestViewModel>();
+
+        TPromise<int32> Promise;
+        ViewModel->ValueRequest.Start(ViewModel, Promise.GetFuture());
+
+        FDelegateHandle Handle = ViewModel->Subscribe(UBaseViewModel::FPropertyChangedDelegate::FDelegate::CreateLambda([](const FViewModelPropertyBase*) {}));
+        ViewModel->Unsubscribe(Handle);
+
+        TestFalse("Is Pending", ViewModel->ValueRequest.IsPending());
+
+        Promise.SetValue(5);
+
+        TestFalse("Has Value", ViewModel->GetValue().IsSet());
+    });
+}
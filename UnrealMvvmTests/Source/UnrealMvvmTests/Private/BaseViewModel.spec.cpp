@@ -72,6 +72,81 @@ void FBaseViewModelSpec::Define()
             TestTrue("No status received", ViewModel->LastSubscriptionStatus.IsSet());
             TestFalse("Wrong status received", ViewModel->LastSubscriptionStatus.Get(true));
         });
+
+        It("Should Ignore Unsubscribe Before Subscribe", [this]()
+        {
+            UTestBaseViewModel* ViewModel = NewObject<UTestBaseViewModel>();
+
+            ViewModel->Unsubscribe(this);
+            ViewModel->Unsubscribe(FDelegateHandle());
+            ViewModel->SetIntValue(5);
+
+            TestFalse("Some View connected", ViewModel->HasConnectedViews());
+            TestFalse("Extra status received", ViewModel->LastSubscriptionStatus.IsSet());
+        });
+    });
+
+    Describe("Intrusive Subscription", [this]()
+    {
+        It("Should Have Connected Views After Subscribe", [this]()
+        {
+            UTestBaseViewModel* ViewModel = NewObject<UTestBaseViewModel>();
+
+            int32 Owner = 0;
+            ViewModel->Subscribe(&Owner, [](void*, UBaseViewModel*, const FViewModelPropertyBase*) {});
+
+            TestTrue("No views connected", ViewModel->HasConnectedViews());
+            TestTrue("Wrong status received", ViewModel->LastSubscriptionStatus.Get(false));
+        });
+
+        It("Should Receive StatusChanged After Last Unsubscribe", [this]()
+        {
+            UTestBaseViewModel* ViewModel = NewObject<UTestBaseViewModel>();
+
+            int32 Owner = 0;
+            UBaseViewModel::FSubscriptionHandle Handle1 = ViewModel->Subscribe(&Owner, [](void*, UBaseViewModel*, const FViewModelPropertyBase*) {});
+            FDelegateHandle Handle2 = ViewModel->Subscribe(FChangeDelegate::CreateLambda([](auto) {}));
+            ViewModel->LastSubscriptionStatus.Reset();
+
+            ViewModel->Unsubscribe(Handle1);
+            TestFalse("Extra status received", ViewModel->LastSubscriptionStatus.IsSet());
+
+            ViewModel->Unsubscribe(Handle2);
+            TestTrue("No status received", ViewModel->LastSubscriptionStatus.IsSet());
+            TestFalse("Wrong status received", ViewModel->LastSubscriptionStatus.Get(true));
+            TestFalse("Some View still connected", ViewModel->HasConnectedViews());
+        });
+
+        It("Should Notify Owner", [this]()
+        {
+            UTestBaseViewModel* ViewModel = NewObject<UTestBaseViewModel>();
+
+            TMap<const FViewModelPropertyBase*, int32> Changes;
+            ViewModel->Subscribe(&Changes, [](void* Owner, UBaseViewModel*, const FViewModelPropertyBase* Property)
+            {
+                static_cast<TMap<const FViewModelPropertyBase*, int32>*>(Owner)->FindOrAdd(Property) += 1;
+            });
+
+            ViewModel->RaiseMultipleChange();
+
+            TestEqual("IntValueProperty changed", Changes.FindRef(UTestBaseViewModel::IntValueProperty()), 1);
+            TestEqual("FloatValueProperty changed", Changes.FindRef(UTestBaseViewModel::FloatValueProperty()), 1);
+        });
+
+        It("Should Unsubscribe By Owner", [this]()
+        {
+            UTestBaseViewModel* ViewModel = NewObject<UTestBaseViewModel>();
+
+            int32 Owner = 0;
+            ViewModel->Subscribe(&Owner, [](void*, UBaseViewModel*, const FViewModelPropertyBase*) {});
+            ViewModel->Subscribe(&Owner, [](void*, UBaseViewModel*, const FViewModelPropertyBase*) {});
+            ViewModel->LastSubscriptionStatus.Reset();
+
+            ViewModel->Unsubscribe(&Owner);
+
+            TestFalse("Some View still connected", ViewModel->HasConnectedViews());
+            TestFalse("Wrong status received", ViewModel->LastSubscriptionStatus.Get(true));
+        });
     });
 
     Describe("RaiseChanged", [this]
@@ -197,6 +197,128 @@ void FBindingConfigurationBuilderSpec::Define()
             TestProperty("Property[3]", Properties[3], { UBindingWorkerViewModel_SecondChild::IntValueProperty(), INDEX_NONE });
         });
     });
+
+    Describe("Handler Slots", [this]
+    {
+        It("Should report property entry for each binding", [this]
+        {
+            FBindingConfigurationBuilder Builder(UBindingWorkerViewModel_Root::StaticClass());
+
+            Builder.AddBinding({ UBindingWorkerViewModel_Root::ChildProperty(), UBindingWorkerViewModel_FirstChild::ChildProperty(), UBindingWorkerViewModel_SecondChild::IntValueProperty() });
+            Builder.AddBinding({ UBindingWorkerViewModel_Root::ChildProperty(), UBindingWorkerViewModel_FirstChild::IntValueProperty() });
+            Builder.AddBinding({ FName("IntValue") });
+
+            TArray<int32> HandlerSlots;
+            FBindingConfiguration Configuration = Builder.Build(&HandlerSlots);
+
+            TestEqual("Num HandlerSlots", HandlerSlots.Num(), 3);
+            TestEqual("HandlerSlots[0]", HandlerSlots[0], 4);
+            TestEqual("HandlerSlots[1]", HandlerSlots[1], 3);
+            TestEqual("HandlerSlots[2]", HandlerSlots[2], 1);
+
+            TArrayView<FResolvedPropertyEntry> Properties = Configuration.GetProperties();
+            TestTrue("Property[HandlerSlots[0]]", Properties[HandlerSlots[0]] == UBindingWorkerViewModel_SecondChild::IntValueProperty());
+            TestTrue("Property[HandlerSlots[1]]", Properties[HandlerSlots[1]] == UBindingWorkerViewModel_FirstChild::IntValueProperty());
+            TestTrue("Property[HandlerSlots[2]]", Properties[HandlerSlots[2]] == UBindingWorkerViewModel_Root::IntValueProperty());
+        });
+
+        It("Should report parent property entry for each property entry", [this]
+        {
+            FBindingConfigurationBuilder Builder(UBindingWorkerViewModel_Root::StaticClass());
+
+            Builder.AddBinding({ UBindingWorkerViewModel_Root::ChildProperty(), UBindingWorkerViewModel_FirstChild::ChildProperty(), UBindingWorkerViewModel_SecondChild::IntValueProperty() });
+            Builder.AddBinding({ UBindingWorkerViewModel_Root::ChildProperty(), UBindingWorkerViewModel_FirstChild::IntValueProperty() });
+            Builder.AddBinding({ FName("IntValue") });
+
+            TArray<int32> ParentProperties;
+            FBindingConfiguration Configuration = Builder.Build(nullptr, &ParentProperties);
+
+            TestEqual("Num ParentProperties", ParentProperties.Num(), 5);
+            TestEqual("ParentProperties[0]", ParentProperties[0], (int32)INDEX_NONE);
+            TestEqual("ParentProperties[1]", ParentProperties[1], (int32)INDEX_NONE);
+            TestEqual("ParentProperties[2]", ParentProperties[2], 0);
+            TestEqual("ParentProperties[3]", ParentProperties[3], 0);
+            TestEqual("ParentProperties[4]", ParentProperties[4], 2);
+        });
+
+        It("Should report INDEX_NONE for ignored binding", [this]
+        {
+            FBindingConfigurationBuilder Builder(UBindingWorkerViewModel_Root::StaticClass());
+
+            Builder.AddBinding({ FName("NonExistingProperty") });
+            Builder.AddBinding({ FName("IntValue") });
+
+            TArray<int32> HandlerSlots;
+            FBindingConfiguration Configuration = Builder.Build(&HandlerSlots);
+
+            TestEqual("Num HandlerSlots", HandlerSlots.Num(), 2);
+            TestEqual("HandlerSlots[0]", HandlerSlots[0], (int32)INDEX_NONE);
+            TestEqual("HandlerSlots[1]", HandlerSlots[1], 0);
+        });
+    });
+
+    Describe("Limits", [this]
+    {
+        auto InitEntries = [](FBindingConfiguration& Configuration)
+        {
+            for (FResolvedViewModelEntry& ViewModelEntry : Configuration.GetViewModels())
+            {
+                ViewModelEntry = FResolvedViewModelEntry{ { UBindingWorkerViewModel_Root::StaticClass() }, 0, 0 };
+            }
+
+            TArrayView<FResolvedPropertyEntry> Properties = Configuration.GetProperties();
+            for (int32 Index = 0; Index < Properties.Num(); ++Index)
+            {
+                Properties[Index] = FResolvedPropertyEntry(UBindingWorkerViewModel_Root::IntValueProperty(), Index);
+            }
+        };
+
+        It("Should use compact layout at limits", [this, InitEntries]
+        {
+            FBindingConfiguration Configuration(MAX_uint8, MAX_uint8);
+            InitEntries(Configuration);
+
+            TestFalse("IsWide", Configuration.IsWide());
+            TestEqual("Num ViewModels", Configuration.GetViewModels().Num(), (int32)MAX_uint8);
+            TestEqual("Num Properties", Configuration.GetProperties().Num(), (int32)MAX_uint8);
+            TestEqual("Last NextViewModel", Configuration.GetProperties().Last().NextViewModelIndex, MAX_uint8 - 1);
+        });
+
+        It("Should use wide layout above limit of Properties", [this, InitEntries]
+        {
+            FBindingConfiguration Configuration(1, MAX_uint8 + 1);
+            InitEntries(Configuration);
+
+            TestTrue("IsWide", Configuration.IsWide());
+            TestEqual("Num ViewModels", Configuration.GetViewModels().Num(), 1);
+            TestEqual("Num Properties", Configuration.GetProperties().Num(), MAX_uint8 + 1);
+            TestEqual("Last NextViewModel", Configuration.GetProperties().Last().NextViewModelIndex, (int32)MAX_uint8);
+        });
+
+        It("Should use wide layout above limit of ViewModels", [this, InitEntries]
+        {
+            FBindingConfiguration Configuration(MAX_uint8 + 1, 1);
+            InitEntries(Configuration);
+
+            TestTrue("IsWide", Configuration.IsWide());
+            TestEqual("Num ViewModels", Configuration.GetViewModels().Num(), MAX_uint8 + 1);
+            TestEqual("Num Properties", Configuration.GetProperties().Num(), 1);
+            TestEqual("Last ViewModel Class", Configuration.GetViewModels().Last().ViewModelClass, UBindingWorkerViewModel_Root::StaticClass());
+        });
+
+        It("Should copy wide layout", [this, InitEntries]
+        {
+            FBindingConfiguration Configuration(1000, 1000);
+            InitEntries(Configuration);
+
+            FBindingConfiguration Copy = Configuration;
+
+            TestTrue("IsWide", Copy.IsWide());
+            TestEqual("Num ViewModels", Copy.GetViewModels().Num(), 1000);
+            TestEqual("Num Properties", Copy.GetProperties().Num(), 1000);
+            TestEqual("Last NextViewModel", Copy.GetProperties().Last().NextViewModelIndex, 999);
+        });
+    });
 }
 
 void FBindingConfigurationBuilderSpec::TestViewModel(const FString& Prefix, const UnrealMvvm_Impl::FResolvedViewModelEntry& Actual, const UnrealMvvm_Impl::FResolvedViewModelEntry& Expected)
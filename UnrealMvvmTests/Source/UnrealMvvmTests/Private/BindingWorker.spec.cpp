@@ -29,6 +29,14 @@ struct FBindingWorkerTestHandler : public UnrealMvvm_Impl::IPropertyChangeHandle
     mutable TArray<TTuple<UBaseViewModel*, const FViewModelPropertyBase*>> Calls;
 };
 
+struct FBindingWorkerTextTestHandler : public FBindingWorkerTestHandler
+{
+    bool IsTextBinding() const override
+    {
+        return true;
+    }
+};
+
 BEGIN_DEFINE_SPEC(FBindingWorkerSpec, "UnrealMvvm.BindingWorker", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
 void TestPropertyPath(TFunctionRef<void(FBindingWorkerTestHandler& Handler, UBindingWorkerViewModel_Root* RootViewModel, UnrealMvvm_Impl::FBindingWorker& Worker)> TestFunction);
 void TestPropertyPathNative(TFunctionRef<void(UBindingWorkerTestView* View, UBindingWorkerViewModel_Root* RootViewModel)> TestFunction);
@@ -146,6 +154,75 @@ void FBindingWorkerSpec::Define()
         });
     });
 
+    Describe("Handler Slots", [this]
+    {
+        It("Should put handlers into precomputed slots", [this]
+        {
+            FBindingConfigurationBuilder Builder(UBindingWorkerViewModel_Root::StaticClass());
+            Builder.AddBinding({ UBindingWorkerViewModel_Root::IntValueProperty() });
+            Builder.AddBinding({ UBindingWorkerViewModel_Root::IntValueProperty() });
+            Builder.AddBinding({ UBindingWorkerViewModel_Root::MinIntValueProperty() });
+
+            TArray<int32> HandlerSlots;
+            TArray<int32> ParentProperties;
+            FBindingConfiguration Configuration = Builder.Build(&HandlerSlots, &ParentProperties);
+
+            FBindingWorker Worker;
+            Worker.Init(nullptr, Configuration);
+
+            FBindingWorkerTestHandler* Handler1;
+            FBindingWorkerTestHandler* Handler2;
+            FBindingWorkerTestHandler* HandlerMin;
+            {
+                FBindingWorker::FHandlerSlotsScope SlotsScope(Worker, HandlerSlots, ParentProperties);
+                Handler1 = &Worker.AddBindingHandler<FBindingWorkerTestHandler>({ UBindingWorkerViewModel_Root::IntValueProperty() });
+                Handler2 = &Worker.AddBindingHandler<FBindingWorkerTestHandler>({ UBindingWorkerViewModel_Root::IntValueProperty() });
+                HandlerMin = &Worker.AddBindingHandler<FBindingWorkerTestHandler>({ UBindingWorkerViewModel_Root::MinIntValueProperty() });
+            }
+
+            UBindingWorkerViewModel_Root* RootViewModel = NewObject<UBindingWorkerViewModel_Root>();
+            Worker.SetViewModel(RootViewModel);
+
+            Worker.StartListening();
+
+            TestTrue("Handlers are different", Handler1 != Handler2);
+            Handler1->TestCall(0, RootViewModel, UBindingWorkerViewModel_Root::IntValueProperty());
+            Handler2->TestCall(0, RootViewModel, UBindingWorkerViewModel_Root::IntValueProperty());
+            HandlerMin->TestCall(0, RootViewModel, UBindingWorkerViewModel_Root::MinIntValueProperty());
+        });
+
+        It("Should fall back to search when handlers are skipped or reordered", [this]
+        {
+            FBindingConfigurationBuilder Builder(UBindingWorkerViewModel_Root::StaticClass());
+            Builder.AddBinding({ UBindingWorkerViewModel_Root::IntValueProperty() });
+            Builder.AddBinding({ UBindingWorkerViewModel_Root::IntValueProperty() });
+            Builder.AddBinding({ UBindingWorkerViewModel_Root::MinIntValueProperty() });
+
+            TArray<int32> HandlerSlots;
+            TArray<int32> ParentProperties;
+            FBindingConfiguration Configuration = Builder.Build(&HandlerSlots, &ParentProperties);
+
+            FBindingWorker Worker;
+            Worker.Init(nullptr, Configuration);
+
+            FBindingWorkerTestHandler* HandlerMin;
+            FBindingWorkerTestHandler* Handler;
+            {
+                FBindingWorker::FHandlerSlotsScope SlotsScope(Worker, HandlerSlots, ParentProperties);
+                HandlerMin = &Worker.AddBindingHandler<FBindingWorkerTestHandler>({ UBindingWorkerViewModel_Root::MinIntValueProperty() });
+                Handler = &Worker.AddBindingHandler<FBindingWorkerTestHandler>({ UBindingWorkerViewModel_Root::IntValueProperty() });
+            }
+
+            UBindingWorkerViewModel_Root* RootViewModel = NewObject<UBindingWorkerViewModel_Root>();
+            Worker.SetViewModel(RootViewModel);
+
+            Worker.StartListening();
+
+            HandlerMin->TestCall(0, RootViewModel, UBindingWorkerViewModel_Root::MinIntValueProperty());
+            Handler->TestCall(0, RootViewModel, UBindingWorkerViewModel_Root::IntValueProperty());
+        });
+    });
+
     Describe("Multiple properties", [this]
     {
         It("Should handle initial value", [this]
@@ -231,6 +308,217 @@ void FBindingWorkerSpec::Define()
         });
     });
 
+    Describe("Rebind", [this]
+    {
+        It("Should invoke only handlers of changed values", [this]
+        {
+            FBindingConfigurationBuilder Builder(UBindingWorkerViewModel_Root::StaticClass());
+            Builder.AddBinding({ UBindingWorkerViewModel_Root::IntValueProperty() });
+            Builder.AddBinding({ UBindingWorkerViewModel_Root::MinIntValueProperty() });
+            FBindingConfiguration Configuration = Builder.Build();
+
+            FBindingWorker Worker;
+            Worker.Init(nullptr, Configuration);
+            FBindingWorkerTestHandler& Handler = Worker.AddBindingHandler<FBindingWorkerTestHandler>({ UBindingWorkerViewModel_Root::IntValueProperty() });
+            FBindingWorkerTestHandler& HandlerMin = Worker.AddBindingHandler<FBindingWorkerTestHandler>({ UBindingWorkerViewModel_Root::MinIntValueProperty() });
+
+            UBindingWorkerViewModel_Root* OldViewModel = NewObject<UBindingWorkerViewModel_Root>();
+            OldViewModel->SetIntValue(1);
+            OldViewModel->SetMinIntValue(1);
+
+            UBindingWorkerViewModel_Root* NewViewModel = NewObject<UBindingWorkerViewModel_Root>();
+            NewViewModel->SetIntValue(1);
+            NewViewModel->SetMinIntValue(2);
+
+            Worker.SetViewModel(OldViewModel);
+            Worker.StartListening();
+            Worker.RebindViewModel(NewViewModel);
+
+            TestEqual("Num IntValue calls", Handler.Calls.Num(), 1);
+            TestEqual("Num MinIntValue calls", HandlerMin.Calls.Num(), 2);
+            HandlerMin.TestCall(1, NewViewModel, UBindingWorkerViewModel_Root::MinIntValueProperty());
+        });
+
+        It("Should listen only to new ViewModel", [this]
+        {
+            FBindingConfigurationBuilder Builder(UBindingWorkerViewModel_Root::StaticClass());
+            Builder.AddBinding({ UBindingWorkerViewModel_Root::IntValueProperty() });
+            FBindingConfiguration Configuration = Builder.Build();
+
+            FBindingWorker Worker;
+            Worker.Init(nullptr, Configuration);
+            FBindingWorkerTestHandler& Handler = Worker.AddBindingHandler<FBindingWorkerTestHandler>({ UBindingWorkerViewModel_Root::IntValueProperty() });
+
+            UBindingWorkerViewModel_Root* OldViewModel = NewObject<UBindingWorkerViewModel_Root>();
+            UBindingWorkerViewModel_Root* NewViewModel = NewObject<UBindingWorkerViewModel_Root>();
+
+            Worker.SetViewModel(OldViewModel);
+            Worker.StartListening();
+            Worker.RebindViewModel(NewViewModel);
+
+            OldViewModel->SetIntValue(1);
+            NewViewModel->SetIntValue(2);
+
+            TestEqual("Num calls", Handler.Calls.Num(), 2);
+            Handler.TestCall(1, NewViewModel, UBindingWorkerViewModel_Root::IntValueProperty());
+        });
+
+        It("Should keep shared ViewModels in Path", [this]
+        {
+            FBindingConfigurationBuilder Builder(UBindingWorkerViewModel_Root::StaticClass());
+            Builder.AddBinding({ UBindingWorkerViewModel_Root::ChildProperty(), UBindingWorkerViewModel_FirstChild::IntValueProperty() });
+            FBindingConfiguration Configuration = Builder.Build();
+
+            FBindingWorker Worker;
+            Worker.Init(nullptr, Configuration);
+            FBindingWorkerTestHandler& Handler = Worker.AddBindingHandler<FBindingWorkerTestHandler>({ UBindingWorkerViewModel_Root::ChildProperty(), UBindingWorkerViewModel_FirstChild::IntValueProperty() });
+
+            UBindingWorkerViewModel_FirstChild* SharedChild = NewObject<UBindingWorkerViewModel_FirstChild>();
+
+            UBindingWorkerViewModel_Root* OldViewModel = NewObject<UBindingWorkerViewModel_Root>();
+            OldViewModel->SetChild(SharedChild);
+
+            UBindingWorkerViewModel_Root* NewViewModel = NewObject<UBindingWorkerViewModel_Root>();
+            NewViewModel->SetChild(SharedChild);
+
+            Worker.SetViewModel(OldViewModel);
+            Worker.StartListening();
+            Worker.RebindViewModel(NewViewModel);
+
+            TestEqual("Num calls after Rebind", Handler.Calls.Num(), 1);
+
+            SharedChild->SetIntValue(5);
+
+            TestEqual("Num calls after change", Handler.Calls.Num(), 2);
+            Handler.TestCall(1, SharedChild, UBindingWorkerViewModel_FirstChild::IntValueProperty());
+        });
+
+        It("Should invoke handlers of changed ViewModel in Path", [this]
+        {
+            FBindingConfigurationBuilder Builder(UBindingWorkerViewModel_Root::StaticClass());
+            Builder.AddBinding({ UBindingWorkerViewModel_Root::ChildProperty(), UBindingWorkerViewModel_FirstChild::IntValueProperty() });
+            FBindingConfiguration Configuration = Builder.Build();
+
+            FBindingWorker Worker;
+            Worker.Init(nullptr, Configuration);
+            FBindingWorkerTestHandler& Handler = Worker.AddBindingHandler<FBindingWorkerTestHandler>({ UBindingWorkerViewModel_Root::ChildProperty(), UBindingWorkerViewModel_FirstChild::IntValueProperty() });
+
+            UBindingWorkerViewModel_FirstChild* OldChild = NewObject<UBindingWorkerViewModel_FirstChild>();
+            OldChild->SetIntValue(1);
+
+            UBindingWorkerViewModel_FirstChild* NewChild = NewObject<UBindingWorkerViewModel_FirstChild>();
+            NewChild->SetIntValue(2);
+
+            UBindingWorkerViewModel_Root* OldViewModel = NewObject<UBindingWorkerViewModel_Root>();
+            OldViewModel->SetChild(OldChild);
+
+            UBindingWorkerViewModel_Root* NewViewModel = NewObject<UBindingWorkerViewModel_Root>();
+            NewViewModel->SetChild(NewChild);
+
+            Worker.SetViewModel(OldViewModel);
+            Worker.StartListening();
+            Worker.RebindViewModel(NewViewModel);
+
+            TestEqual("Num calls after Rebind", Handler.Calls.Num(), 2);
+            Handler.TestCall(1, NewChild, UBindingWorkerViewModel_FirstChild::IntValueProperty());
+
+            OldChild->SetIntValue(3);
+            TestEqual("Num calls after change of old Child", Handler.Calls.Num(), 2);
+        });
+    });
+
+    Describe("Diff Flags", [this]
+    {
+        It("Should keep flags set before Init or without bindings", [this]
+        {
+            FBindingWorker Worker;
+            Worker.SetDiffRebindEnabled(true);
+            Worker.SetDiffPropagationEnabled(true);
+            TestTrue("Enabled without configuration", Worker.IsDiffRebindEnabled());
+            TestTrue("Propagation enabled without configuration", Worker.IsDiffPropagationEnabled());
+
+            FBindingConfigurationBuilder Builder(UBindingWorkerViewModel_Root::StaticClass());
+            Builder.AddBinding({ UBindingWorkerViewModel_Root::IntValueProperty() });
+            FBindingConfiguration Configuration = Builder.Build();
+
+            Worker.Init(nullptr, Configuration);
+            TestTrue("Enabled after Init", Worker.IsDiffRebindEnabled());
+            TestTrue("Propagation enabled after Init", Worker.IsDiffPropagationEnabled());
+
+            FBindingWorker OtherWorker;
+            OtherWorker.Init(nullptr, Configuration);
+            TestFalse("Other Worker enabled", OtherWorker.IsDiffRebindEnabled());
+            TestFalse("Other Worker propagation enabled", OtherWorker.IsDiffPropagationEnabled());
+        });
+    });
+
+    Describe("Diff Propagation", [this]
+    {
+        It("Should skip handlers of equal values in Path", [this]
+        {
+            FBindingConfigurationBuilder Builder(UBindingWorkerViewModel_Root::StaticClass());
+            Builder.AddBinding({ UBindingWorkerViewModel_Root::ChildProperty(), UBindingWorkerViewModel_FirstChild::IntValueProperty() });
+            FBindingConfiguration Configuration = Builder.Build();
+
+            FBindingWorker Worker;
+            Worker.Init(nullptr, Configuration);
+            Worker.SetDiffPropagationEnabled(true);
+            FBindingWorkerTestHandler& Handler = Worker.AddBindingHandler<FBindingWorkerTestHandler>({ UBindingWorkerViewModel_Root::ChildProperty(), UBindingWorkerViewModel_FirstChild::IntValueProperty() });
+
+            UBindingWorkerViewModel_FirstChild* FirstChild = NewObject<UBindingWorkerViewModel_FirstChild>();
+            FirstChild->SetIntValue(1);
+
+            UBindingWorkerViewModel_FirstChild* SameChild = NewObject<UBindingWorkerViewModel_FirstChild>();
+            SameChild->SetIntValue(1);
+
+            UBindingWorkerViewModel_FirstChild* OtherChild = NewObject<UBindingWorkerViewModel_FirstChild>();
+            OtherChild->SetIntValue(2);
+
+            UBindingWorkerViewModel_Root* ViewModel = NewObject<UBindingWorkerViewModel_Root>();
+            ViewModel->SetChild(FirstChild);
+
+            Worker.SetViewModel(ViewModel);
+            Worker.StartListening();
+
+            ViewModel->SetChild(SameChild);
+            TestEqual("Num calls after equal Child", Handler.Calls.Num(), 1);
+
+            ViewModel->SetChild(OtherChild);
+            TestEqual("Num calls after different Child", Handler.Calls.Num(), 2);
+            Handler.TestCall(1, OtherChild, UBindingWorkerViewModel_FirstChild::IntValueProperty());
+
+            SameChild->SetIntValue(3);
+            OtherChild->SetIntValue(3);
+            TestEqual("Num calls after change of Child", Handler.Calls.Num(), 3);
+        });
+
+        It("Should invoke all handlers when disabled", [this]
+        {
+            FBindingConfigurationBuilder Builder(UBindingWorkerViewModel_Root::StaticClass());
+            Builder.AddBinding({ UBindingWorkerViewModel_Root::ChildProperty(), UBindingWorkerViewModel_FirstChild::IntValueProperty() });
+            FBindingConfiguration Configuration = Builder.Build();
+
+            FBindingWorker Worker;
+            Worker.Init(nullptr, Configuration);
+            FBindingWorkerTestHandler& Handler = Worker.AddBindingHandler<FBindingWorkerTestHandler>({ UBindingWorkerViewModel_Root::ChildProperty(), UBindingWorkerViewModel_FirstChild::IntValueProperty() });
+
+            UBindingWorkerViewModel_FirstChild* FirstChild = NewObject<UBindingWorkerViewModel_FirstChild>();
+            FirstChild->SetIntValue(1);
+
+            UBindingWorkerViewModel_FirstChild* SameChild = NewObject<UBindingWorkerViewModel_FirstChild>();
+            SameChild->SetIntValue(1);
+
+            UBindingWorkerViewModel_Root* ViewModel = NewObject<UBindingWorkerViewModel_Root>();
+            ViewModel->SetChild(FirstChild);
+
+            Worker.SetViewModel(ViewModel);
+            Worker.StartListening();
+
+            ViewModel->SetChild(SameChild);
+            TestEqual("Num calls after equal Child", Handler.Calls.Num(), 2);
+        });
+    });
+
     Describe("PropertyPath", [this]
     {
         It("Should handle initial value", [this]
@@ -454,6 +742,63 @@ void FBindingWorkerSpec::Define()
             });
         });
     });
+
+    Describe("Text Bindings Refresh", [this]
+    {
+        It("Should invoke only text handlers", [this]
+        {
+            FBindingConfigurationBuilder Builder(UBindingWorkerViewModel_Root::StaticClass());
+            Builder.AddBinding({ UBindingWorkerViewModel_Root::IntValueProperty() });
+            Builder.AddBinding({ UBindingWorkerViewModel_Root::IntValueProperty() });
+            FBindingConfiguration Configuration = Builder.Build();
+
+            FBindingWorker Worker;
+            Worker.Init(nullptr, Configuration);
+            FBindingWorkerTestHandler& Handler = Worker.AddBindingHandler<FBindingWorkerTestHandler>({ UBindingWorkerViewModel_Root::IntValueProperty() });
+            FBindingWorkerTextTestHandler& TextHandler = Worker.AddBindingHandler<FBindingWorkerTextTestHandler>({ UBindingWorkerViewModel_Root::IntValueProperty() });
+
+            UBindingWorkerViewModel_Root* RootViewModel = NewObject<UBindingWorkerViewModel_Root>();
+            Worker.SetViewModel(RootViewModel);
+            Worker.StartListening();
+
+            FBindingWorker::RefreshTextBindings(0.0);
+
+            TestEqual("Handler Calls", Handler.Calls.Num(), 1);
+            TestEqual("TextHandler Calls", TextHandler.Calls.Num(), 2);
+            TextHandler.TestCall(1, RootViewModel, UBindingWorkerViewModel_Root::IntValueProperty());
+        });
+
+        It("Should process workers in batches", [this]
+        {
+            FBindingConfigurationBuilder Builder(UBindingWorkerViewModel_Root::StaticClass());
+            Builder.AddBinding({ UBindingWorkerViewModel_Root::IntValueProperty() });
+            FBindingConfiguration Configuration = Builder.Build();
+
+            UBindingWorkerViewModel_Root* RootViewModel = NewObject<UBindingWorkerViewModel_Root>();
+
+            FBindingWorker Workers[2];
+            FBindingWorkerTextTestHandler* Handlers[2];
+            for (int32 Index = 0; Index < 2; ++Index)
+            {
+                Workers[Index].Init(nullptr, Configuration);
+                Handlers[Index] = &Workers[Index].AddBindingHandler<FBindingWorkerTextTestHandler>({ UBindingWorkerViewModel_Root::IntValueProperty() });
+                Workers[Index].SetViewModel(RootViewModel);
+                Workers[Index].StartListening();
+            }
+
+            // budget is exhausted right after the first worker
+            FBindingWorker::RefreshTextBindings(1e-12);
+
+            TestTrue("Is Refreshing", FBindingWorker::IsRefreshingTextBindings());
+            TestEqual("Total Calls", Handlers[0]->Calls.Num() + Handlers[1]->Calls.Num(), 3);
+
+            // stopped worker is dropped from pending list
+            Workers[0].StopListening();
+            Workers[1].StopListening();
+
+            TestFalse("Is Refreshing", FBindingWorker::IsRefreshingTextBindings());
+        });
+    });
 }
 
 void FBindingWorkerSpec::TestPropertyPath(TFunctionRef<void(FBindingWorkerTestHandler& Handler, UBindingWorkerViewModel_Root* RootViewModel, UnrealMvvm_Impl::FBindingWorker& Worker)> TestFunction)
@@ -0,0 +1,56 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Mvvm/Impl/BaseView/BaseViewComponentImpl.h"
+#include "PropertyBindingTestTarget.h"
+
+using namespace UnrealMvvm_Impl;
+
+BEGIN_DEFINE_SPEC(FBlueprintDispatchSpec, "UnrealMvvm.BlueprintDispatch", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FBlueprintDispatchSpec)
+
+void FBlueprintDispatchSpec::Define()
+{
+    It("Should Pass Binding Index To Dispatch Function", [this]()
+    {
+        UPropertyBindingTestTarget* View = NewObject<UPropertyBindingTestTarget>();
+        UFunction* Dispatch = View->FindFunctionChecked(GET_FUNCTION_NAME_CHECKED(UPropertyBindingTestTarget, Dispatch));
+
+        FBlueprintPropertyChangeHandler First(View, Dispatch, 0);
+        FBlueprintPropertyChangeHandler Second(View, Dispatch, 3);
+
+        Second.Invoke(nullptr, nullptr);
+        First.Invoke(nullptr, nullptr);
+        Second.Invoke(nullptr, nullptr);
+
+        TestEqual("DispatchedIndices", View->DispatchedIndices, TArray<int32>{ 3, 0, 3 });
+    });
+
+    It("Should Defer Dispatch Of Initializing View Until Batch Ends", [this]()
+    {
+        UPropertyBindingTestTarget* View = NewObject<UPropertyBindingTestTarget>();
+        UPropertyBindingTestTarget* OtherView = NewObject<UPropertyBindingTestTarget>();
+        UFunction* Dispatch = View->FindFunctionChecked(GET_FUNCTION_NAME_CHECKED(UPropertyBindingTestTarget, Dispatch));
+
+        FBlueprintPropertyChangeHandler First(View, Dispatch, 0);
+        FBlueprintPropertyChangeHandler Second(View, Dispatch, 3);
+        FBlueprintPropertyChangeHandler Other(OtherView, Dispatch, 1);
+
+        {
+            FBlueprintDispatchBatch Batch(View);
+
+            Second.Invoke(nullptr, nullptr);
+            First.Invoke(nullptr, nullptr);
+            Other.Invoke(nullptr, nullptr);
+
+            TestEqual("DispatchedIndices during batch", View->DispatchedIndices, TArray<int32>{});
+            TestEqual("Other DispatchedIndices during batch", OtherView->DispatchedIndices, TArray<int32>{ 1 });
+        }
+
+        // native test class has no batch event, so indices are dispatched one by one in the order of invocation
+        TestEqual("DispatchedIndices", View->DispatchedIndices, TArray<int32>{ 3, 0 });
+
+        First.Invoke(nullptr, nullptr);
+        TestEqual("DispatchedIndices after batch", View->DispatchedIndices, TArray<int32>{ 3, 0, 0 });
+    });
+}
@@ -0,0 +1,133 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Mvvm/Impl/BaseView/BaseViewComponentImpl.h"
+#include "Mvvm/Impl/Property/ViewModelRegistry.h"
+#include "PropertyBindingTestTarget.h"
+#include "TestBaseViewModel.h"
+
+using namespace UnrealMvvm_Impl;
+
+BEGIN_DEFINE_SPEC(FDirectPropertyBindingSpec, "UnrealMvvm.DirectPropertyBinding", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+
+TSharedRef<FViewRegistry::FPropertyBinding> MakeBinding(FName SourceName, TArray<FName> TargetPath, EPropertyBindingConversion Conversion)
+{
+    TSharedRef<FViewRegistry::FPropertyBinding> Binding = MakeShared<FViewRegistry::FPropertyBinding>();
+    Binding->Source = FViewModelRegistry::FindProperty<UTestBaseViewModel>(SourceName);
+    Binding->Conversion = Conversion;
+
+    UStruct* Owner = UPropertyBindingTestTarget::StaticClass();
+    for (FName Name : TargetPath)
+    {
+        FProperty* Property = FindFProperty<FProperty>(Owner, Name);
+        Binding->TargetPath.Add(Property);
+
+        if (FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+        {
+            Owner = ObjectProperty->PropertyClass;
+        }
+    }
+
+    return Binding;
+}
+
+END_DEFINE_SPEC(FDirectPropertyBindingSpec)
+
+void FDirectPropertyBindingSpec::Define()
+{
+    It("Should Copy Value Of The Same Type", [this]()
+    {
+        UTestBaseViewModel* ViewModel = NewObject<UTestBaseViewModel>();
+        UPropertyBindingTestTarget* View = NewObject<UPropertyBindingTestTarget>();
+        ViewModel->SetIntValue(42);
+
+        FDirectPropertyChangeHandler Handler(View, MakeBinding("IntValue", { "IntValue" }, EPropertyBindingConversion::None));
+        Handler.Invoke(ViewModel, nullptr);
+
+        TestEqual("IntValue", View->IntValue, 42);
+    });
+
+    It("Should Convert Numeric Value", [this]()
+    {
+        UTestBaseViewModel* ViewModel = NewObject<UTestBaseViewModel>();
+        UPropertyBindingTestTarget* View = NewObject<UPropertyBindingTestTarget>();
+        ViewModel->SetFloatValue(0.5f);
+
+        FDirectPropertyChangeHandler Handler(View, MakeBinding("FloatValue", { "DoubleValue" }, EPropertyBindingConversion::FromFloat));
+        Handler.Invoke(ViewModel, nullptr);
+
+        TestEqual("DoubleValue", View->DoubleValue, 0.5);
+    });
+
+    It("Should Write Into Property Of Referenced Object", [this]()
+    {
+        UTestBaseViewModel* ViewModel = NewObject<UTestBaseViewModel>();
+        UPropertyBindingTestTarget* View = NewObject<UPropertyBindingTestTarget>();
+        ViewModel->SetIntValue(7);
+
+        FDirectPropertyChangeHandler Handler(View, MakeBinding("IntValue", { "Child", "DoubleValue" }, EPropertyBindingConversion::FromInt));
+
+        // no object yet, nothing should happen
+        Handler.Invoke(ViewModel, nullptr);
+
+        View->Child = NewObject<UPropertyBindingTestTarget>();
+        Handler.Invoke(ViewModel, nullptr);
+
+        TestEqual("DoubleValue", View->Child->DoubleValue, 7.0);
+    });
+
+    It("Should Format Float As Percent Text", [this]()
+    {
+        UTestBaseViewModel* ViewModel = NewObject<UTestBaseViewModel>();
+        UPropertyBindingTestTarget* View = NewObject<UPropertyBindingTestTarget>();
+        ViewModel->SetFloatValue(0.25f);
+
+        FDirectPropertyChangeHandler Handler(View, MakeBinding("FloatValue", { "TextValue" }, EPropertyBindingConversion::FloatToPercentText));
+        Handler.Invoke(ViewModel, nullptr);
+
+        TestEqual("TextValue", View->TextValue.ToString(), FText::AsPercent(0.25f).ToString());
+    });
+
+    It("Should Copy Only Into Property Of The Same Type", [this]()
+    {
+        const FViewModelPropertyOperations& IntOps = FViewModelRegistry::FindProperty<UTestBaseViewModel>("IntValue")->GetOperations();
+        const FViewModelPropertyOperations& FloatOps = FViewModelRegistry::FindProperty<UTestBaseViewModel>("FloatValue")->GetOperations();
+
+        UClass* TargetClass = UPropertyBindingTestTarget::StaticClass();
+        FProperty* IntTarget = FindFProperty<FProperty>(TargetClass, "IntValue");
+        FProperty* DoubleTarget = FindFProperty<FProperty>(TargetClass, "DoubleValue");
+        FProperty* TextTarget = FindFProperty<FProperty>(TargetClass, "TextValue");
+
+        TestTrue("int32 to int32", IntOps.IsSameType(IntTarget));
+        TestFalse("int32 to double", IntOps.IsSameType(DoubleTarget));
+        TestFalse("float to double", FloatOps.IsSameType(DoubleTarget));
+        TestFalse("float to FText", FloatOps.IsSameType(TextTarget));
+    });
+
+    It("Should Report Exact Primitive Type Of Source", [this]()
+    {
+        const FViewModelPropertyOperations& IntOps = FViewModelRegistry::FindProperty<UTestBaseViewModel>("IntValue")->GetOperations();
+        const FViewModelPropertyOperations& FloatOps = FViewModelRegistry::FindProperty<UTestBaseViewModel>("FloatValue")->GetOperations();
+        const FViewModelPropertyOperations& StructOps = FViewModelRegistry::FindProperty<UTestBaseViewModel>("StructValue")->GetOperations();
+
+        TestTrue("int32 is Int", IntOps.IsPrimitiveType(EPrimitiveValueType::Int));
+        TestFalse("int32 is Int64", IntOps.IsPrimitiveType(EPrimitiveValueType::Int64));
+        TestFalse("int32 is Float", IntOps.IsPrimitiveType(EPrimitiveValueType::Float));
+        TestTrue("float is Float", FloatOps.IsPrimitiveType(EPrimitiveValueType::Float));
+        TestFalse("float is Double", FloatOps.IsPrimitiveType(EPrimitiveValueType::Double));
+        TestFalse("struct is Bool", StructOps.IsPrimitiveType(EPrimitiveValueType::Bool));
+    });
+
+    It("Should Ignore Unresolved Binding", [this]()
+    {
+        UTestBaseViewModel* ViewModel = NewObject<UTestBaseViewModel>();
+        UPropertyBindingTestTarget* View = NewObject<UPropertyBindingTestTarget>();
+        ViewModel->SetIntValue(42);
+
+        TSharedRef<FViewRegistry::FPropertyBinding> Binding = MakeShared<FViewRegistry::FPropertyBinding>();
+        FDirectPropertyChangeHandler Handler(View, Binding);
+        Handler.Invoke(ViewModel, nullptr);
+
+        TestEqual("IntValue", View->IntValue, 0);
+    });
+}
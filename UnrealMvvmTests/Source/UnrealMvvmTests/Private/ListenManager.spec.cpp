@@ -3,6 +3,7 @@
 #include "Misc/AutomationTest.h"
 
 #include "Mvvm/ListenManager.h"
+#include "Containers/Ticker.h"
 
 #include "TestListener.h"
 
@@ -22,6 +23,9 @@ public:
     FTestDelegate& DelegateMethod() { return DelegateField; }
     FTestDelegate& DelegateMethodConst() const { return DelegateField; }
 
+    DECLARE_MULTICAST_DELEGATE_OneParam(FTestIntDelegate, int32);
+    FTestIntDelegate IntDelegateField;
+
     mutable FTestDynamicDelegate DynamicDelegateField;
     FTestDynamicDelegate& DynamicDelegateMethod() { return DynamicDelegateField; }
     FTestDynamicDelegate& DynamicDelegateMethodConst() const { return DynamicDelegateField; }
@@ -705,6 +709,152 @@ void ListenManagerSpec::Define()
         });
     });
 
+    Describe("Coalescing", [this]()
+    {
+        It("Should Throttle Simple Delegate To Last Arguments", [this]()
+        {
+            FEventHolder Holder;
+            FListenManager Manager;
+            int32 NumInvocations = 0;
+            int32 LastValue = 0;
+
+            Manager.Listen(&Holder, &FEventHolder::IntDelegateField).Throttle().WithLambda([&](int32 Value) { ++NumInvocations; LastValue = Value; });
+            Holder.IntDelegateField.Broadcast(1);
+
+            TestEqual("Invocations after first event", NumInvocations, 1);
+            TestEqual("First value", LastValue, 1);
+
+            Holder.IntDelegateField.Broadcast(2);
+            Holder.IntDelegateField.Broadcast(3);
+
+            TestEqual("Invocations before tick", NumInvocations, 1);
+
+            FTSTicker::GetCoreTicker().Tick(0.f);
+
+            TestEqual("Invocations after tick", NumInvocations, 2);
+            TestEqual("Last value", LastValue, 3);
+
+            FTSTicker::GetCoreTicker().Tick(0.f);
+
+            TestEqual("Invocations after second tick", NumInvocations, 2);
+        });
+
+        It("Should Suppress Throttled Events Until Interval Passes", [this]()
+        {
+            FEventHolder Holder;
+            FListenManager Manager;
+            int32 NumInvocations = 0;
+            int32 LastValue = 0;
+
+            Manager.Listen(&Holder, &FEventHolder::IntDelegateField).Throttle(1000.f).WithLambda([&](int32 Value) { ++NumInvocations; LastValue = Value; });
+            Holder.IntDelegateField.Broadcast(1);
+            Holder.IntDelegateField.Broadcast(2);
+
+            FTSTicker::GetCoreTicker().Tick(0.f);
+
+            TestEqual("Invocations", NumInvocations, 1);
+            TestEqual("Value", LastValue, 1);
+        });
+
+        It("Should Debounce Simple Delegate Until Interval Passes", [this]()
+        {
+            FEventHolder Holder;
+            FListenManager Manager;
+            int32 NumInvocations = 0;
+
+            Manager.Listen(&Holder, &FEventHolder::IntDelegateField).Debounce(1000.f).WithLambda([&](int32 Value) { ++NumInvocations; });
+            Holder.IntDelegateField.Broadcast(1);
+
+            FTSTicker::GetCoreTicker().Tick(0.f);
+
+            TestEqual("Invocations", NumInvocations, 0);
+        });
+
+        It("Should Drop Pending Invocation When Unsubscribed", [this]()
+        {
+            FEventHolder Holder;
+            FListenManager Manager;
+            int32 NumInvocations = 0;
+
+            Manager.Listen(&Holder, &FEventHolder::IntDelegateField).Throttle().WithLambda([&](int32 Value) { ++NumInvocations; });
+            Holder.IntDelegateField.Broadcast(1);
+            Holder.IntDelegateField.Broadcast(2);
+            Manager.UnsubscribeAll();
+
+            FTSTicker::GetCoreTicker().Tick(0.f);
+
+            TestFalse("Listener not removed", Holder.IntDelegateField.IsBound());
+            TestEqual("Invocations", NumInvocations, 1);
+        });
+
+        It("Should Throttle Dynamic Delegate", [this]()
+        {
+            UTestEventHolder* Holder = NewObject<UTestEventHolder>();
+            FListenManager Manager;
+            UTestListener* Listener = NewObject<UTestListener>();
+
+            Manager.Listen(Holder, &UTestEventHolder::DynamicDelegateField).Throttle().WithDynamic(Listener, &UTestListener::DynamicCallback);
+            Holder->DynamicDelegateField.Broadcast();
+
+            TestTrue("Listener added", Holder->DynamicDelegateField.IsBound());
+            TestTrue("Listener invoked on first event", Listener->Invoked);
+
+            Listener->Invoked = false;
+            Holder->DynamicDelegateField.Broadcast();
+
+            TestFalse("Listener invoked before tick", Listener->Invoked);
+
+            FTSTicker::GetCoreTicker().Tick(0.f);
+
+            TestTrue("Listener invoked after tick", Listener->Invoked);
+
+            Manager.UnsubscribeAll();
+
+            TestFalse("Listener not removed", Holder->DynamicDelegateField.IsBound());
+        });
+    });
+
+    Describe("Bulk Unsubscribe", [this]()
+    {
+        It("Should Remove All Bindings Of Subscriber From Event", [this]()
+        {
+            FEventHolder Holder;
+            FListenManager Manager;
+            UTestListener* Listener = NewObject<UTestListener>();
+            bool bLambdaInvoked = false;
+
+            Manager.Listen(&Holder, &FEventHolder::DelegateField).WithUObject(Listener, &UTestListener::SimpleCallback);
+            Manager.Listen(&Holder, &FEventHolder::DelegateField).WithWeakLambda(Listener, [Listener]() { Listener->Invoked = true; });
+            Manager.Listen(&Holder, &FEventHolder::DelegateField).Throttle().WithUObject(Listener, &UTestListener::SimpleCallback);
+            Manager.Listen(&Holder, &FEventHolder::DelegateField).WithLambda([&bLambdaInvoked]() { bLambdaInvoked = true; });
+
+            Manager.UnsubscribeAll(&Holder, &FEventHolder::DelegateField, Listener);
+            Holder.DelegateField.Broadcast();
+            FTSTicker::GetCoreTicker().Tick(0.f);
+
+            TestFalse("Listener invoked", Listener->Invoked);
+            TestTrue("Lambda invoked", bLambdaInvoked);
+
+            Manager.UnsubscribeAll();
+
+            TestFalse("Listener not removed", Holder.DelegateField.IsBound());
+        });
+
+        It("Should Remove All Dynamic Bindings Of Subscriber From Event", [this]()
+        {
+            UTestEventHolder* Holder = NewObject<UTestEventHolder>();
+            FListenManager Manager;
+            UTestListener* Listener = NewObject<UTestListener>();
+
+            Manager.Listen(Holder, &UTestEventHolder::DynamicDelegateField).WithDynamic(Listener, &UTestListener::DynamicCallback);
+            Manager.Listen(Holder, &UTestEventHolder::DynamicDelegateField).Throttle().WithDynamic(Listener, &UTestListener::DynamicCallback);
+
+            Manager.UnsubscribeAll(Holder, &UTestEventHolder::DynamicDelegateField, Listener);
+
+            TestFalse("Listener not removed", Holder->DynamicDelegateField.IsBound());
+        });
+    });
+
     It("Should Remove All Subscriptions From Destructor", [this]()
     {
         FEventHolder Holder;
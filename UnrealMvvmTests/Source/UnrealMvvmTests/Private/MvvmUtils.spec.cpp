@@ -110,6 +110,84 @@ void FMvvmUtilsSpec::Define()
             });
         });
     });
+
+    Describe("SyncViewModelCollectionIncremental", [this]
+    {
+        It("Should Process Limited Number Of Models Per Call", [this]
+        {
+            TArray<FString> Models{ TEXT("1"), TEXT("2"), TEXT("3"), TEXT("4"), TEXT("5") };
+            TArray<UUtilsTestViewModel*> ViewModels;
+            MvvmUtils::FSyncViewModelCollectionCursor Cursor;
+            Cursor.MaxItemsPerCall = 2;
+
+            TestFalse("First call completed", MvvmUtils::SyncViewModelCollectionIncremental(ViewModels, Models, Cursor));
+            TestEqual("ViewModels.Num()", ViewModels.Num(), 2);
+            TestEqual("NumProcessed", Cursor.GetNumProcessed(), 2);
+            TestEqual("Progress", Cursor.GetProgress(), 0.4f);
+
+            TestFalse("Second call completed", MvvmUtils::SyncViewModelCollectionIncremental(ViewModels, Models, Cursor));
+            TestTrue("Third call completed", MvvmUtils::SyncViewModelCollectionIncremental(ViewModels, Models, Cursor));
+            TestTrue("IsComplete", Cursor.IsComplete());
+
+            TestEqual("ViewModels.Num()", ViewModels.Num(), Models.Num());
+            for (int32 Index = 0; Index < Models.Num(); ++Index)
+            {
+                TestEqual("Model", ViewModels[Index]->Model, Models[Index]);
+            }
+        });
+
+        It("Should Keep Previous Models Of Unprocessed ViewModels", [this]
+        {
+            TArray<FString> Models{ TEXT("1"), TEXT("2"), TEXT("3") };
+            TArray<TObjectPtr<UUtilsTestViewModel>> ViewModels;
+            MvvmUtils::SyncViewModelCollection(ViewModels, TArray<FString>{ TEXT("a"), TEXT("b"), TEXT("c"), TEXT("d") });
+
+            MvvmUtils::FSyncViewModelCollectionCursor Cursor;
+            Cursor.MaxItemsPerCall = 1;
+
+            MvvmUtils::SyncViewModelCollectionIncremental(ViewModels, Models, Cursor);
+
+            TestEqual("ViewModels.Num()", ViewModels.Num(), Models.Num());
+            TestEqual("ViewModels[0]", ViewModels[0]->Model, TEXT("1"));
+            TestEqual("ViewModels[1]", ViewModels[1]->Model, TEXT("b"));
+            TestEqual("ViewModels[2]", ViewModels[2]->Model, TEXT("c"));
+        });
+
+        It("Should Restart When Number Of Models Changes", [this]
+        {
+            TArray<FString> Models{ TEXT("1"), TEXT("2"), TEXT("3") };
+            TArray<UUtilsTestViewModel*> ViewModels;
+            MvvmUtils::FSyncViewModelCollectionCursor Cursor;
+            Cursor.MaxItemsPerCall = 2;
+
+            MvvmUtils::SyncViewModelCollectionIncremental(ViewModels, Models, Cursor);
+
+            Models.Insert(TEXT("0"), 0);
+            MvvmUtils::SyncViewModelCollectionIncremental(ViewModels, Models, Cursor);
+
+            TestEqual("NumTotal", Cursor.GetNumTotal(), 4);
+            TestEqual("NumProcessed", Cursor.GetNumProcessed(), 2);
+            TestEqual("ViewModels[0]", ViewModels[0]->Model, TEXT("0"));
+            TestEqual("ViewModels[1]", ViewModels[1]->Model, TEXT("1"));
+        });
+
+        It("Should Process At Least One Model With Time Budget", [this]
+        {
+            TArray<FString> Models{ TEXT("1"), TEXT("2"), TEXT("3") };
+            TArray<UUtilsTestViewModel*> ViewModels;
+            MvvmUtils::FSyncViewModelCollectionCursor Cursor;
+            Cursor.MaxSecondsPerCall = 0.000001;
+
+            int32 NumCalls = 0;
+            while (!MvvmUtils::SyncViewModelCollectionIncremental(ViewModels, Models, Cursor))
+            {
+                NumCalls++;
+            }
+
+            TestTrue("NumCalls", NumCalls < Models.Num());
+            TestEqual("ViewModels.Num()", ViewModels.Num(), Models.Num());
+        });
+    });
 }
 
 template<typename TInner, typename TCallback>
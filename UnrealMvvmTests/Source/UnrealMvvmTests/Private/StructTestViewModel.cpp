@@ -0,0 +1,12 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "StructTestViewModel.h"
+
+int32 FStructTestViewModel::GetDoubledValue() const { return IntValueField * 2; }
+
+VM_STRUCT_PROP_IMPL(FStructTestViewModel, IntValue);
+VM_STRUCT_PROP_IMPL(FStructTestViewModel, TextValue);
+VM_STRUCT_PROP_IMPL(FStructTestViewModel, FloatValue);
+VM_STRUCT_PROP_IMPL(FStructTestViewModel, SoftObjectValue);
+VM_STRUCT_PROP_IMPL(FStructTestViewModel, PrivateSetterValue);
+VM_STRUCT_PROP_IMPL_MG_NF(FStructTestViewModel, DoubledValue);
@@ -0,0 +1,175 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/StrongObjectPtr.h"
+
+#include "Mvvm/StructViewModelBinding.h"
+#include "StructTestViewModel.h"
+#include "TestBaseViewModel.h"
+
+BEGIN_DEFINE_SPEC(FStructViewModelSpec, "UnrealMvvm.StructViewModel", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+struct FTestTextBlock
+{
+    void SetText(const FText& InText) { Text = InText; Calls++; }
+
+    FText Text;
+    int32 Calls = 0;
+};
+END_DEFINE_SPEC(FStructViewModelSpec)
+
+BEGIN_DEFINE_SPEC(FStructViewModelBenchmarkSpec, "UnrealMvvm.StructViewModel.Benchmark", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::PerfFilter)
+static constexpr int32 NumViewModels = 100000;
+void AddTiming(const TCHAR* Name, double StartTime);
+END_DEFINE_SPEC(FStructViewModelBenchmarkSpec)
+
+void FStructViewModelSpec::Define()
+{
+    It("Should Invoke Handlers When ViewModel Is Set", [this]()
+    {
+        FStructTestViewModel ViewModel;
+        ViewModel.SetIntValue(5);
+
+        TStructViewModelBinding<FStructTestViewModel> Binding;
+        int32 IntValue = 0, DoubledValue = 0;
+        Bind(&Binding, FStructTestViewModel::IntValueProperty(), [&](int32 Value) { IntValue = Value; });
+        Bind(&Binding, FStructTestViewModel::DoubledValueProperty(), [&](int32 Value) { DoubledValue = Value; });
+
+        Binding.SetViewModel(&ViewModel);
+
+        TestEqual("IntValue", IntValue, 5);
+        TestEqual("DoubledValue", DoubledValue, 10);
+
+        Binding.SetViewModel(nullptr);
+    });
+
+    It("Should Invoke Handler When Property Changes", [this]()
+    {
+        FStructTestViewModel ViewModel;
+        FTestTextBlock TextBlock;
+
+        TStructViewModelBinding<FStructTestViewModel> Binding;
+        Bind(&Binding, FStructTestViewModel::TextValueProperty(), &TextBlock);
+        Binding.SetViewModel(&ViewModel);
+
+        ViewModel.SetTextValue(FText::FromString(TEXT("Test")));
+
+        TestEqual("Calls", TextBlock.Calls, 2);
+        TestEqual("Text", TextBlock.Text.ToString(), TEXT("Test"));
+
+        Binding.SetViewModel(nullptr);
+    });
+
+    It("Should Unsubscribe When Binding Is Destroyed", [this]()
+    {
+        FStructTestViewModel ViewModel;
+
+        {
+            TStructViewModelBinding<FStructTestViewModel> Binding;
+            Bind(&Binding, FStructTestViewModel::IntValueProperty(), [](int32) {});
+            Binding.SetViewModel(&ViewModel);
+
+            TestTrue("Has connected Views", ViewModel.HasConnectedViews());
+            TestTrue("Status", ViewModel.LastSubscriptionStatus.Get(false));
+        }
+
+        TestFalse("Has connected Views", ViewModel.HasConnectedViews());
+        TestFalse("Status", ViewModel.LastSubscriptionStatus.Get(true));
+    });
+
+    It("Should Move Subscription To New ViewModel", [this]()
+    {
+        FStructTestViewModel First, Second;
+        Second.SetIntValue(2);
+
+        TStructViewModelBinding<FStructTestViewModel> Binding;
+        int32 IntValue = 0;
+        Bind(&Binding, FStructTestViewModel::IntValueProperty(), [&](int32 Value) { IntValue = Value; });
+
+        Binding.SetViewModel(&First);
+        Binding.SetViewModel(&Second);
+        First.SetIntValue(1);
+
+        TestEqual("IntValue", IntValue, 2);
+        TestFalse("First has connected Views", First.HasConnectedViews());
+        TestTrue("Second has connected Views", Second.HasConnectedViews());
+
+        Binding.SetViewModel(nullptr);
+    });
+
+    It("Should Be Stored In UObject ViewModel", [this]()
+    {
+        TStrongObjectPtr<UStructOwnerTestViewModel> Owner{ NewObject<UStructOwnerTestViewModel>() };
+        Owner->SetRow(MakeShared<FStructTestViewModel>());
+        Owner->GetRow()->SetIntValue(3);
+
+        TStructViewModelBinding<FStructTestViewModel> Binding;
+        int32 IntValue = 0;
+        Bind(&Binding, FStructTestViewModel::IntValueProperty(), [&](int32 Value) { IntValue = Value; });
+        Binding.SetViewModel(Owner->GetRow().Get());
+
+        TestEqual("IntValue", IntValue, 3);
+
+        Binding.SetViewModel(nullptr);
+    });
+
+    It("Should Keep Accessor Visibility Of Declaration", [this]()
+    {
+        TestTrue("IntValue has public Setter", FStructTestViewModel::IntValueProperty()->HasPublicSetter());
+        TestTrue("PrivateSetterValue has public Getter", FStructTestViewModel::PrivateSetterValueProperty()->HasPublicGetter());
+        TestFalse("PrivateSetterValue has public Setter", FStructTestViewModel::PrivateSetterValueProperty()->HasPublicSetter());
+        TestFalse("DoubledValue has Setter", FStructTestViewModel::DoubledValueProperty()->HasSetter());
+    });
+}
+
+void FStructViewModelBenchmarkSpec::Define()
+{
+    It("Should Compare Allocation With UObject ViewModels", [this]()
+    {
+        // UObject ViewModels
+        {
+            TArray<TStrongObjectPtr<UTestBaseViewModel>> ViewModels;
+            ViewModels.Reserve(NumViewModels);
+
+            double StartTime = FPlatformTime::Seconds();
+            for (int32 Index = 0; Index < NumViewModels; ++Index)
+            {
+                ViewModels.Emplace(NewObject<UTestBaseViewModel>());
+            }
+            AddTiming(TEXT("UObject Create"), StartTime);
+
+            StartTime = FPlatformTime::Seconds();
+            CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+            AddTiming(TEXT("UObject CollectGarbage"), StartTime);
+
+            ViewModels.Empty();
+            CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+        }
+
+        // struct ViewModels
+        {
+            TArray<TUniquePtr<FStructTestViewModel>> ViewModels;
+            ViewModels.Reserve(NumViewModels);
+
+            double StartTime = FPlatformTime::Seconds();
+            for (int32 Index = 0; Index < NumViewModels; ++Index)
+            {
+                ViewModels.Emplace(MakeUnique<FStructTestViewModel>());
+            }
+            AddTiming(TEXT("Struct Create"), StartTime);
+
+            StartTime = FPlatformTime::Seconds();
+            CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+            AddTiming(TEXT("Struct CollectGarbage"), StartTime);
+
+            StartTime = FPlatformTime::Seconds();
+            ViewModels.Empty();
+            AddTiming(TEXT("Struct Destroy"), StartTime);
+        }
+    });
+}
+
+void FStructViewModelBenchmarkSpec::AddTiming(const TCHAR* Name, double StartTime)
+{
+    AddInfo(FString::Printf(TEXT("%s: %.3f ms"), Name, (FPlatformTime::Seconds() - StartTime) * 1000.0));
+}
@@ -0,0 +1,118 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#include "Mvvm/StructViewModelBinding.h"
+#include "Mvvm/Impl/Binding/BindingConfiguration.h"
+#include "StructTestViewModel.h"
+
+class UTextBlock;
+
+namespace TextBindingTest
+{
+    using namespace UnrealMvvm_Impl;
+
+    // text bindings must be stored inside handler without allocations
+    static_assert(sizeof(TBindingPropertyChangeHandler<UBaseViewModel, FText, TTextSetter<TObjectPtr<UTextBlock>>>) <= FResolvedPropertyEntry::HandlerBufferSize, "FText binding does not fit inline");
+    static_assert(sizeof(TBindingPropertyChangeHandler<UBaseViewModel, FString, TStringToTextSetter<TObjectPtr<UTextBlock>>>) <= FResolvedPropertyEntry::HandlerBufferSize, "FString binding does not fit inline");
+    static_assert(sizeof(TBindingPropertyChangeHandler<UBaseViewModel, int32, TNumberToTextSetter<TObjectPtr<UTextBlock>, int32>>) <= FResolvedPropertyEntry::HandlerBufferSize, "int32 binding does not fit inline");
+    static_assert(sizeof(TBindingPropertyChangeHandler<UBaseViewModel, double, TNumberToTextSetter<TObjectPtr<UTextBlock>, double>>) <= FResolvedPropertyEntry::HandlerBufferSize, "double binding does not fit inline");
+}
+
+BEGIN_DEFINE_SPEC(FTextBindingSpec, "UnrealMvvm.TextBinding", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+struct FTestTextBlock
+{
+    void SetText(const FText& InText) { Text = InText; Calls++; }
+    FText GetText() const { return Text; }
+
+    FText Text;
+    int32 Calls = 0;
+};
+END_DEFINE_SPEC(FTextBindingSpec)
+
+void FTextBindingSpec::Define()
+{
+    It("Should Skip SetText When Text Is Unchanged", [this]()
+    {
+        const FText Text = FText::FromString(TEXT("Test"));
+
+        FStructTestViewModel First, Second;
+        First.SetTextValue(Text);
+        Second.SetTextValue(Text);
+
+        FTestTextBlock TextBlock;
+        TStructViewModelBinding<FStructTestViewModel> Binding;
+        Bind(&Binding, FStructTestViewModel::TextValueProperty(), &TextBlock);
+
+        Binding.SetViewModel(&First);
+        Binding.SetViewModel(&Second);
+
+        TestEqual("Calls", TextBlock.Calls, 1);
+
+        Binding.SetViewModel(nullptr);
+    });
+
+    It("Should Skip SetText When Number Is Unchanged", [this]()
+    {
+        FStructTestViewModel First, Second;
+        First.SetIntValue(5);
+        Second.SetIntValue(5);
+
+        FTestTextBlock TextBlock;
+        TStructViewModelBinding<FStructTestViewModel> Binding;
+        Bind(&Binding, FStructTestViewModel::IntValueProperty(), &TextBlock);
+
+        Binding.SetViewModel(&First);
+        Binding.SetViewModel(&Second);
+
+        TestEqual("Calls", TextBlock.Calls, 1);
+
+        Second.SetIntValue(6);
+
+        TestEqual("Calls", TextBlock.Calls, 2);
+        TestEqual("Text", TextBlock.Text.ToString(), TEXT("6"));
+
+        Binding.SetViewModel(nullptr);
+    });
+
+    It("Should Skip SetText When Formatted Number Is Unchanged", [this]()
+    {
+        FStructTestViewModel ViewModel;
+        ViewModel.SetFloatValue(1.2f);
+
+        FNumberFormattingOptions Options;
+        Options.MaximumFractionalDigits = 0;
+
+        FTestTextBlock TextBlock;
+        TStructViewModelBinding<FStructTestViewModel> Binding;
+        Bind(&Binding, FStructTestViewModel::FloatValueProperty(), &TextBlock, &Options);
+        Binding.SetViewModel(&ViewModel);
+
+        ViewModel.SetFloatValue(1.3f);
+
+        TestEqual("Calls", TextBlock.Calls, 1);
+
+        Binding.SetViewModel(nullptr);
+    });
+
+    It("Should Share Formatted Number Between Bindings", [this]()
+    {
+        FStructTestViewModel ViewModel;
+        ViewModel.SetIntValue(12345);
+
+        FNumberFormattingOptions Options;
+        Options.UseGrouping = false;
+
+        FTestTextBlock First, Second, Ungrouped;
+        TStructViewModelBinding<FStructTestViewModel> Binding;
+        Bind(&Binding, FStructTestViewModel::IntValueProperty(), &First);
+        Bind(&Binding, FStructTestViewModel::IntValueProperty(), &Second);
+        Bind(&Binding, FStructTestViewModel::IntValueProperty(), &Ungrouped, &Options);
+        Binding.SetViewModel(&ViewModel);
+
+        TestTrue("Same text", First.Text.IdenticalTo(Second.Text));
+        TestFalse("Different options", First.Text.IdenticalTo(Ungrouped.Text));
+
+        Binding.SetViewModel(nullptr);
+    });
+}
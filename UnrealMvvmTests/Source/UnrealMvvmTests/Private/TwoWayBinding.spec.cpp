@@ -0,0 +1,112 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Containers/Ticker.h"
+#include "TwoWayBindingTestView.h"
+#include "TestBaseViewModel.h"
+#include "TempWorldHelper.h"
+
+BEGIN_DEFINE_SPEC(FTwoWayBindingSpec, "UnrealMvvm.TwoWayBinding", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FTwoWayBindingSpec)
+
+void FTwoWayBindingSpec::Define()
+{
+    It("Should Apply ViewModel Value To Control", [this]()
+    {
+        FTempWorldHelper Helper;
+
+        ATwoWayBindingTestView* View = Helper.World->SpawnActor<ATwoWayBindingTestView>();
+        UTestBaseViewModel* ViewModel = NewObject<UTestBaseViewModel>();
+        ViewModel->SetIntValue(3);
+
+        View->DispatchBeginPlay();
+        View->SetViewModel(ViewModel);
+        TestEqual("Value", View->Control->Value, 3);
+
+        ViewModel->SetIntValue(4);
+        TestEqual("Value", View->Control->Value, 4);
+    });
+
+    It("Should Write Last Control Value Once Per Frame Without Echo", [this]()
+    {
+        FTempWorldHelper Helper;
+
+        ATwoWayBindingTestView* View = Helper.World->SpawnActor<ATwoWayBindingTestView>();
+        UTestBaseViewModel* ViewModel = NewObject<UTestBaseViewModel>();
+
+        View->DispatchBeginPlay();
+        View->SetViewModel(ViewModel);
+        const int32 NumSetValueCalls = View->Control->NumSetValueCalls;
+
+        View->Control->OnValueChanged.Broadcast(5);
+        View->Control->OnValueChanged.Broadcast(6);
+        TestEqual("ViewModel value before tick", ViewModel->GetIntValue(), 0);
+
+        FTSTicker::GetCoreTicker().Tick(0.f);
+        TestEqual("ViewModel value after tick", ViewModel->GetIntValue(), 6);
+        TestEqual("SetValue calls", View->Control->NumSetValueCalls, NumSetValueCalls);
+    });
+
+    It("Should Not Write When View Has No ViewModel", [this]()
+    {
+        FTempWorldHelper Helper;
+
+        ATwoWayBindingTestView* View = Helper.World->SpawnActor<ATwoWayBindingTestView>();
+        UTestBaseViewModel* ViewModel = NewObject<UTestBaseViewModel>();
+
+        View->DispatchBeginPlay();
+        View->SetViewModel(ViewModel);
+
+        UTwoWayTestControl* Control = View->Control;
+        View->SetViewModel(nullptr);
+
+        Control->OnValueChanged.Broadcast(5);
+        FTSTicker::GetCoreTicker().Tick(0.f);
+        TestEqual("ViewModel value", ViewModel->GetIntValue(), 0);
+    });
+
+    It("Should Drop Value When ViewModel Is Replaced Before Write", [this]()
+    {
+        FTempWorldHelper Helper;
+
+        ATwoWayBindingTestView* View = Helper.World->SpawnActor<ATwoWayBindingTestView>();
+        UTestBaseViewModel* OldViewModel = NewObject<UTestBaseViewModel>();
+        UTestBaseViewModel* NewViewModel = NewObject<UTestBaseViewModel>();
+
+        View->DispatchBeginPlay();
+        View->SetViewModel(OldViewModel);
+
+        View->Control->OnValueChanged.Broadcast(5);
+        View->SetViewModel(NewViewModel);
+        FTSTicker::GetCoreTicker().Tick(0.f);
+
+        TestEqual("Old ViewModel value", OldViewModel->GetIntValue(), 0);
+        TestEqual("New ViewModel value", NewViewModel->GetIntValue(), 0);
+        TestEqual("Control value", View->Control->Value, 0);
+    });
+
+    It("Should Apply Value Adjusted By ViewModel Setter To Control", [this]()
+    {
+        FTempWorldHelper Helper;
+
+        ATwoWayClampingTestView* View = Helper.World->SpawnActor<ATwoWayClampingTestView>();
+        UTwoWayClampingTestViewModel* ViewModel = NewObject<UTwoWayClampingTestViewModel>();
+
+        View->DispatchBeginPlay();
+        View->SetViewModel(ViewModel);
+
+        View->Control->Value = 15;
+        View->Control->OnValueChanged.Broadcast(15);
+        FTSTicker::GetCoreTicker().Tick(0.f);
+
+        TestEqual("ViewModel value", ViewModel->GetClampedValue(), 10);
+        TestEqual("Control value", View->Control->Value, 10);
+
+        // ViewModel value does not change, but Control still has to be reset
+        View->Control->Value = 20;
+        View->Control->OnValueChanged.Broadcast(20);
+        FTSTicker::GetCoreTicker().Tick(0.f);
+
+        TestEqual("Control value is reset", View->Control->Value, 10);
+    });
+}
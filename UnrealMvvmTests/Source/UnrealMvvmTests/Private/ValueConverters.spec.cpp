@@ -0,0 +1,69 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Mvvm/BaseView.h"
+#include "Mvvm/Impl/Binding/BindingConfiguration.h"
+
+using namespace UnrealMvvm_Impl;
+
+namespace ValueConvertersTest
+{
+    using FPercentSetter = TConvertingSetter<float, decltype(MvvmConverters::Clamp(0.f, 1.f) | MvvmConverters::ToPercentText()), UObject*>;
+    using FVisibilitySetter = TConvertingSetter<bool, FToVisibilityConverter, UObject*>;
+    using FBrushSetter = TConvertingSetter<uint8, FEnumToBrushConverter, UObject*>;
+
+    // common pipelines must be stored inside handler without allocations
+    static_assert(sizeof(TBindingPropertyChangeHandler<UBaseViewModel, float, FPercentSetter>) <= FResolvedPropertyEntry::HandlerBufferSize, "Percent pipeline does not fit inline");
+    static_assert(sizeof(TBindingPropertyChangeHandler<UBaseViewModel, bool, FVisibilitySetter>) <= FResolvedPropertyEntry::HandlerBufferSize, "Visibility pipeline does not fit inline");
+    static_assert(sizeof(TBindingPropertyChangeHandler<UBaseViewModel, uint8, FBrushSetter>) <= FResolvedPropertyEntry::HandlerBufferSize, "Brush pipeline does not fit inline");
+}
+
+BEGIN_DEFINE_SPEC(FValueConvertersSpec, "UnrealMvvm.ValueConverters", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+END_DEFINE_SPEC(FValueConvertersSpec)
+
+void FValueConvertersSpec::Define()
+{
+    It("Should Convert Bool To Visibility", [this]()
+    {
+        auto Converter = MvvmConverters::ToVisibility(ESlateVisibility::HitTestInvisible, ESlateVisibility::Hidden);
+
+        TestTrue("True", Converter(true) == ESlateVisibility::HitTestInvisible);
+        TestTrue("False", Converter(false) == ESlateVisibility::Hidden);
+    });
+
+    It("Should Compose Converters In Order", [this]()
+    {
+        auto Converter = MvvmConverters::Clamp(0.f, 1.f) | MvvmConverters::Scale(10.f);
+
+        TestEqual("Clamped", Converter(5.f), 10.f);
+        TestEqual("Scaled", Converter(0.5f), 5.f);
+    });
+
+    It("Should Format Percent Text", [this]()
+    {
+        auto Converter = MvvmConverters::Clamp(0.f, 1.f) | MvvmConverters::ToPercentText();
+
+        TestEqual("Text", Converter(2.f).ToString(), FText::AsPercent(1.f).ToString());
+    });
+
+    It("Should Select Brush By Enum Value", [this]()
+    {
+        FSlateBrush Brushes[2];
+        Brushes[1].TintColor = FLinearColor::Red;
+
+        auto Converter = MvvmConverters::EnumToBrush(MakeArrayView(Brushes));
+
+        TestTrue("Brush", Converter(ESlateVisibility::Collapsed).TintColor == FLinearColor::Red);
+    });
+
+    It("Should Pass Converted Value To Callable Target", [this]()
+    {
+        ESlateVisibility Result = ESlateVisibility::Visible;
+        auto Target = [&Result](ESlateVisibility Value) { Result = Value; };
+
+        TConvertingSetter<bool, FToVisibilityConverter, decltype(Target)> Setter(MvvmConverters::ToVisibility(), Target);
+        Setter(false);
+
+        TestTrue("Result", Result == ESlateVisibility::Collapsed);
+    });
+}
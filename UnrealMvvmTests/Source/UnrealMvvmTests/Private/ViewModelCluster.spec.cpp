@@ -0,0 +1,153 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/StrongObjectPtr.h"
+
+#include "ClusterTestViewModel.h"
+
+BEGIN_DEFINE_SPEC(FViewModelClusterSpec, "UnrealMvvm.BaseViewModel.Cluster", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+static UClusterTestViewModel* MakeViewModel(int32 NumItems);
+END_DEFINE_SPEC(FViewModelClusterSpec)
+
+BEGIN_DEFINE_SPEC(FViewModelClusterBenchmarkSpec, "UnrealMvvm.BaseViewModel.Cluster.Benchmark", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::PerfFilter)
+static constexpr int32 NumItems = 20000;
+static constexpr int32 NumCollects = 5;
+double MeasureCollectGarbage();
+END_DEFINE_SPEC(FViewModelClusterBenchmarkSpec)
+
+void FViewModelClusterSpec::Define()
+{
+    It("Should put child ViewModels into cluster", [this]()
+    {
+        TStrongObjectPtr<UClusterTestViewModel> ViewModel{ MakeViewModel(3) };
+
+        TestTrue("Cluster created", ViewModel->CreateViewModelCluster());
+
+        TestTrue("Root in cluster", ViewModel->IsInViewModelCluster());
+        for (UClusterTestItemViewModel* Item : ViewModel->GetItems())
+        {
+            TestTrue("Item in cluster", Item->IsInViewModelCluster());
+        }
+
+        ViewModel->DissolveViewModelCluster();
+    });
+
+    It("Should reject ViewModel with plain object reference", [this]()
+    {
+        TStrongObjectPtr<UClusterTestPlainReferenceViewModel> ViewModel{ NewObject<UClusterTestPlainReferenceViewModel>() };
+        ViewModel->Item = NewObject<UClusterTestItemViewModel>();
+
+        TestFalse("Cluster created", ViewModel->CreateViewModelCluster());
+        TestFalse("Root in cluster", ViewModel->IsInViewModelCluster());
+        TestFalse("Item in cluster", ViewModel->Item->IsInViewModelCluster());
+    });
+
+    It("Should reject plain object with references reachable from ViewModel property", [this]()
+    {
+        TStrongObjectPtr<UClusterTestPlainObjectViewModel> ViewModel{ NewObject<UClusterTestPlainObjectViewModel>() };
+        UClusterTestPlainObject* Object = NewObject<UClusterTestPlainObject>();
+        Object->Item = NewObject<UClusterTestItemViewModel>();
+        ViewModel->SetObject(Object);
+
+        TestFalse("Cluster created", ViewModel->CreateViewModelCluster());
+        TestFalse("Root in cluster", ViewModel->IsInViewModelCluster());
+
+        // reference inside plain object changes without notification, GC must still see it
+        Object->Item = NewObject<UClusterTestItemViewModel>();
+        TWeakObjectPtr<UClusterTestItemViewModel> NewItem = Object->Item.Get();
+
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+        TestTrue("New Item Alive", NewItem.IsValid());
+    });
+
+    It("Should keep clustered ViewModels alive", [this]()
+    {
+        TStrongObjectPtr<UClusterTestViewModel> ViewModel{ MakeViewModel(3) };
+        TWeakObjectPtr<UClusterTestItemViewModel> Item = ViewModel->GetItems()[0].Get();
+
+        ViewModel->CreateViewModelCluster();
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+        TestTrue("Item Alive", Item.IsValid());
+
+        ViewModel->DissolveViewModelCluster();
+    });
+
+    It("Should keep cluster when plain value changes", [this]()
+    {
+        TStrongObjectPtr<UClusterTestViewModel> ViewModel{ MakeViewModel(3) };
+
+        ViewModel->CreateViewModelCluster();
+        ViewModel->SetIntValue(5);
+        ViewModel->GetItems()[0]->SetIntValue(5);
+
+        TestTrue("Root in cluster", ViewModel->IsInViewModelCluster());
+        TestTrue("Item in cluster", ViewModel->GetItems()[0]->IsInViewModelCluster());
+
+        ViewModel->DissolveViewModelCluster();
+    });
+
+    It("Should dissolve cluster when references change", [this]()
+    {
+        TStrongObjectPtr<UClusterTestViewModel> ViewModel{ MakeViewModel(3) };
+        TWeakObjectPtr<UClusterTestItemViewModel> OldItem = ViewModel->GetItems()[0].Get();
+
+        ViewModel->CreateViewModelCluster();
+
+        TArray<TObjectPtr<UClusterTestItemViewModel>> NewItems = ViewModel->GetItems();
+        NewItems.Add(NewObject<UClusterTestItemViewModel>());
+        TWeakObjectPtr<UClusterTestItemViewModel> NewItem = NewItems.Last().Get();
+        ViewModel->SetItems(NewItems);
+
+        TestFalse("Root in cluster", ViewModel->IsInViewModelCluster());
+        TestFalse("Old Item in cluster", OldItem->IsInViewModelCluster());
+
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+        TestTrue("Old Item Alive", OldItem.IsValid());
+        TestTrue("New Item Alive", NewItem.IsValid());
+    });
+}
+
+UClusterTestViewModel* FViewModelClusterSpec::MakeViewModel(int32 NumItems)
+{
+    UClusterTestViewModel* ViewModel = NewObject<UClusterTestViewModel>();
+
+    TArray<TObjectPtr<UClusterTestItemViewModel>> Items;
+    for (int32 Index = 0; Index < NumItems; ++Index)
+    {
+        Items.Add(NewObject<UClusterTestItemViewModel>());
+    }
+
+    ViewModel->SetItems(Items);
+    return ViewModel;
+}
+
+void FViewModelClusterBenchmarkSpec::Define()
+{
+    It("Should Compare Mark Time With And Without Cluster", [this]()
+    {
+        TStrongObjectPtr<UClusterTestViewModel> ViewModel{ FViewModelClusterSpec::MakeViewModel(NumItems) };
+
+        const double PlainTime = MeasureCollectGarbage();
+
+        ViewModel->CreateViewModelCluster();
+        const double ClusterTime = MeasureCollectGarbage();
+        ViewModel->DissolveViewModelCluster();
+
+        AddInfo(FString::Printf(TEXT("CollectGarbage with %d items: %.3f ms plain, %.3f ms clustered, %.3f ms delta"), NumItems, PlainTime, ClusterTime, PlainTime - ClusterTime));
+    });
+}
+
+double FViewModelClusterBenchmarkSpec::MeasureCollectGarbage()
+{
+    const double StartTime = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < NumCollects; ++Index)
+    {
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+    }
+
+    return (FPlatformTime::Seconds() - StartTime) * 1000.0 / NumCollects;
+}
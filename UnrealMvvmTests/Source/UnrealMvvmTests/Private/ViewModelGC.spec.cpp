@@ -5,6 +5,8 @@
 #include "GCTestViewModel.h"
 #include "UObject/StrongObjectPtr.h"
 #include "Mvvm/Impl/Property/PropertyFactory.h"
+#include "Mvvm/Impl/Property/ViewModelRegistry.h"
+#include "Algo/Count.h"
 
 BEGIN_DEFINE_SPEC(FViewModelGCSpec, "UnrealMvvm.BaseViewModel.Garbage Collect", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
 
@@ -249,6 +251,63 @@ void FViewModelGCSpec::Define()
             });
         });
     });
+
+    Describe("Struct References", [this]
+    {
+        It("Should detect object references in struct", [this]
+        {
+            using namespace UnrealMvvm_Impl;
+
+            TestTrue("Struct", FViewModelRegistry::FindProperty<UGCTestViewModel>("Struct")->GetOperations().ContainsObjectReference(true));
+            TestTrue("StructArray", FViewModelRegistry::FindProperty<UGCTestViewModel>("StructArray")->GetOperations().ContainsObjectReference(true));
+            TestTrue("StructMapValue", FViewModelRegistry::FindProperty<UGCTestViewModel>("StructMapValue")->GetOperations().ContainsObjectReference(true));
+
+            TestFalse("PlainStruct", FViewModelRegistry::FindProperty<UGCTestViewModel>("PlainStruct")->GetOperations().ContainsObjectReference(true));
+            TestFalse("PlainStructArray", FViewModelRegistry::FindProperty<UGCTestViewModel>("PlainStructArray")->GetOperations().ContainsObjectReference(true));
+        });
+
+        It("Should add only properties with object references to token stream", [this]
+        {
+            using namespace UnrealMvvm_Impl;
+
+            const TArray<FViewModelPropertyReflection>& Properties = FViewModelRegistry::GetAllProperties()[UGCTestViewModel::StaticClass()];
+            const int32 NumWithReferences = Algo::CountIf(Properties, [](const FViewModelPropertyReflection& Property)
+            {
+                return Property.GetOperations().ContainsObjectReference(false);
+            });
+
+            TestTrue("Some properties skipped", NumWithReferences < Properties.Num());
+            AddInfo(FString::Printf(TEXT("%d of %d properties produce GC references"), NumWithReferences, Properties.Num()));
+        });
+
+        It("Should keep object stored in struct next to plain structs", [this]
+        {
+            TestCommon([](UGCTestViewModel* ViewModel, auto Obj)
+            {
+                ViewModel->SetPlainStruct({ 1, FVector2D::UnitVector });
+                ViewModel->SetPlainStructArray({ {}, {} });
+                ViewModel->SetStruct({ Obj, {} });
+            });
+        });
+    });
+
+    Describe("Regenerated", [this]
+    {
+        It("Should keep object stored in Derived ViewModel after regeneration of Base", [this]
+        {
+            UnrealMvvm_Impl::FViewModelRegistry::GenerateReferenceTokenStreams({ UGCTestViewModel::StaticClass() });
+
+            TestDerived([](UGCTestDerivedViewModel* ViewModel, auto Obj)
+            {
+                ViewModel->SetDerivedPointer({ Obj });
+            });
+
+            TestDerivedEmpty([](UGCTestDerivedEmptyViewModel* ViewModel, auto Obj)
+            {
+                ViewModel->SetPointer({ Obj });
+            });
+        });
+    });
 }
 
 
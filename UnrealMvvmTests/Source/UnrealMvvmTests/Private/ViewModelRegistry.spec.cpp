@@ -7,6 +7,9 @@
 #include "TokenStreamTestViewModel.h"
 #include "Mvvm/Impl/Property/ViewModelPropertyIterator.h"
 #include "Mvvm/Impl/Property/TokenStreamUtils.h"
+#include "Mvvm/BaseViewModel.h"
+#include "Algo/Count.h"
+#include "HAL/PlatformTime.h"
 
 #include "Components/PanelWidget.h"
 #include "Components/CanvasPanel.h"
@@ -20,6 +23,10 @@ TArray<FField*> GetFields(UClass* Class);
 UClass* MakeTempClass(UClass* Class);
 END_DEFINE_SPEC(ViewModelRegistrySpec)
 
+BEGIN_DEFINE_SPEC(ViewModelRegistryBenchmarkSpec, "UnrealMvvm.ViewModelRegistry.Benchmark", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::PerfFilter)
+void AddTiming(const TCHAR* Name, double StartTime);
+END_DEFINE_SPEC(ViewModelRegistryBenchmarkSpec)
+
 void ViewModelRegistrySpec::Define()
 {
     Describe("GetProperties", [this]()
@@ -111,6 +118,16 @@ void ViewModelRegistrySpec::Define()
             TestTrue("Contains UCheckBox", Classes.Contains(UCheckBox::StaticClass()));
         });
 
+        It("Should Add Derived Classes Of Root Class Without Duplicates", [this]
+        {
+            TArray<UClass*> Classes = { UPanelWidget::StaticClass(), UCanvasPanel::StaticClass() };
+            FTokenStreamUtils::EnrichWithDerivedClasses(Classes, UWidget::StaticClass());
+
+            TestTrue("Contains UCheckBox", Classes.Contains(UCheckBox::StaticClass()));
+            TestFalse("Contains UWidget", Classes.Contains(UWidget::StaticClass()));
+            TestEqual("Num UCanvasPanel", Algo::Count(Classes, UCanvasPanel::StaticClass()), 1);
+        });
+
         It("Should Sort Classes By Inheritance Hierarchy", [this]
         {
             TArray<UClass*> Classes =
@@ -189,6 +206,31 @@ void ViewModelRegistrySpec::Define()
             }
         });
 
+        It("Should Not Link Class When Adding Properties", [this]
+        {
+            UClass* TargetClass = MakeTempClass(UTokenStreamTargetClass_WithProperties::StaticClass());
+            auto Properties = FViewModelRegistry::GetAllProperties()[UTokenStreamTestViewModel::StaticClass()];
+            FProperty* ExpectedFirstProperty = TargetClass->PropertyLink;
+
+            FField* FirstField = FTokenStreamUtils::AddPropertiesToClass(TargetClass, MakeArrayView(Properties));
+
+            TestEqual("TargetClass->PropertyLink", TargetClass->PropertyLink, ExpectedFirstProperty);
+
+            // new properties must be linked anyway
+            for (FField* Field = TargetClass->ChildProperties; Field != FirstField; Field = Field->Next)
+            {
+                TestTrue(Field->GetName() + " Size", CastFieldChecked<FProperty>(Field)->GetSize() > 0);
+            }
+
+            // perform cleanup
+            TArray<FField*> KeptProperties;
+            FTokenStreamUtils::CleanupProperties(TargetClass, FirstField, KeptProperties);
+            for (FField* Field : KeptProperties)
+            {
+                delete Field;
+            }
+        });
+
         It("Should Remove Properties From Class Without Own Properties", [this]
         {
             UClass* TargetClass = MakeTempClass(UTokenStreamTargetClass_NoProperties::StaticClass());
@@ -464,6 +506,30 @@ void ViewModelRegistrySpec::Define()
     });
 }
 
+void ViewModelRegistryBenchmarkSpec::Define()
+{
+    It("Should Generate Token Streams Of All ViewModels", [this]
+    {
+        TArray<UClass*> Classes;
+        FViewModelRegistry::GetAllProperties().GetKeys(Classes);
+
+        double StartTime = FPlatformTime::Seconds();
+        TArray<UClass*> EnrichedClasses = Classes;
+        FTokenStreamUtils::EnrichWithDerivedClasses(EnrichedClasses, UBaseViewModel::StaticClass());
+        FTokenStreamUtils::SortViewModelClasses(EnrichedClasses);
+        AddTiming(*FString::Printf(TEXT("Collect and sort %d classes"), EnrichedClasses.Num()), StartTime);
+
+        StartTime = FPlatformTime::Seconds();
+        FViewModelRegistry::GenerateReferenceTokenStreams(Classes);
+        AddTiming(*FString::Printf(TEXT("Generate token streams of %d classes"), EnrichedClasses.Num()), StartTime);
+    });
+}
+
+void ViewModelRegistryBenchmarkSpec::AddTiming(const TCHAR* Name, double StartTime)
+{
+    AddInfo(FString::Printf(TEXT("%s: %.3f ms"), Name, (FPlatformTime::Seconds() - StartTime) * 1000.0));
+}
+
 TArray<FField*> ViewModelRegistrySpec::GetFields(UClass* Class)
 {
     TArray<FField*> Result;
@@ -0,0 +1,236 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+
+#include "Mvvm/Impl/Binding/ViewModelSubscribers.h"
+#include "TestBaseViewModel.h"
+
+using namespace UnrealMvvm_Impl;
+
+BEGIN_DEFINE_SPEC(FViewModelSubscribersSpec, "UnrealMvvm.ViewModelSubscribers", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+static void CountCall(void* Owner, UBaseViewModel* ViewModel, const FViewModelPropertyBase* Property);
+END_DEFINE_SPEC(FViewModelSubscribersSpec)
+
+BEGIN_DEFINE_SPEC(FViewModelSubscribersBenchmarkSpec, "UnrealMvvm.ViewModelSubscribers.Benchmark", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::PerfFilter)
+static constexpr int32 NumLists = 10000;
+static constexpr int32 NumBroadcasts = 10;
+struct FCounter
+{
+    void OnPropertyChanged(const FViewModelPropertyBase* Property) { Calls++; }
+    int32 Calls = 0;
+};
+void AddTiming(const TCHAR* Name, double StartTime);
+END_DEFINE_SPEC(FViewModelSubscribersBenchmarkSpec)
+
+void FViewModelSubscribersSpec::Define()
+{
+    It("Should Notify All Subscribers", [this]()
+    {
+        FViewModelSubscribers Subscribers;
+        int32 Calls1 = 0, Calls2 = 0;
+
+        Subscribers.Add(&Calls1, &CountCall);
+        Subscribers.Add(&Calls2, &CountCall);
+        Subscribers.Broadcast(nullptr, nullptr);
+
+        TestEqual("Num", Subscribers.Num(), 2);
+        TestEqual("Calls1", Calls1, 1);
+        TestEqual("Calls2", Calls2, 1);
+    });
+
+    It("Should Keep Handles Valid After Remove", [this]()
+    {
+        FViewModelSubscribers Subscribers;
+        int32 Calls1 = 0, Calls2 = 0, Calls3 = 0;
+
+        FViewModelSubscriptionHandle Handle1 = Subscribers.Add(&Calls1, &CountCall);
+        FViewModelSubscriptionHandle Handle2 = Subscribers.Add(&Calls2, &CountCall);
+
+        Subscribers.Remove(Handle1);
+        FViewModelSubscriptionHandle Handle3 = Subscribers.Add(&Calls3, &CountCall);
+        TestEqual("Hole reused", Handle3.Index, Handle1.Index);
+
+        Subscribers.Remove(Handle2);
+        Subscribers.Broadcast(nullptr, nullptr);
+
+        TestEqual("Num", Subscribers.Num(), 1);
+        TestEqual("Calls1", Calls1, 0);
+        TestEqual("Calls2", Calls2, 0);
+        TestEqual("Calls3", Calls3, 1);
+    });
+
+    It("Should Remove All By Owner", [this]()
+    {
+        FViewModelSubscribers Subscribers;
+        int32 Calls1 = 0, Calls2 = 0;
+
+        Subscribers.Add(&Calls1, &CountCall);
+        Subscribers.Add(&Calls2, &CountCall);
+        Subscribers.Add(&Calls1, &CountCall);
+
+        TestEqual("Removed", Subscribers.RemoveAll(&Calls1), 2);
+        Subscribers.Broadcast(nullptr, nullptr);
+
+        TestEqual("Num", Subscribers.Num(), 1);
+        TestEqual("Calls1", Calls1, 0);
+        TestEqual("Calls2", Calls2, 1);
+    });
+
+    It("Should Skip Subscriber Removed During Broadcast", [this]()
+    {
+        struct FRemover
+        {
+            FViewModelSubscribers* Subscribers;
+            FViewModelSubscriptionHandle Handle;
+        };
+
+        FViewModelSubscribers Subscribers;
+        int32 Calls = 0;
+
+        FRemover Remover{ &Subscribers };
+        Subscribers.Add(&Remover, [](void* Owner, UBaseViewModel*, const FViewModelPropertyBase*)
+        {
+            FRemover* Remover = static_cast<FRemover*>(Owner);
+            Remover->Subscribers->Remove(Remover->Handle);
+        });
+        Remover.Handle = Subscribers.Add(&Calls, &CountCall);
+
+        Subscribers.Broadcast(nullptr, nullptr);
+
+        TestEqual("Num", Subscribers.Num(), 1);
+        TestEqual("Calls", Calls, 0);
+    });
+
+    It("Should Ignore Stale Handle", [this]()
+    {
+        FViewModelSubscribers Subscribers;
+        int32 Calls1 = 0, Calls2 = 0, Calls3 = 0;
+
+        FViewModelSubscriptionHandle Handle1 = Subscribers.Add(&Calls1, &CountCall);
+        Subscribers.Add(&Calls2, &CountCall);
+        Subscribers.RemoveAll(&Calls1);
+
+        FViewModelSubscriptionHandle Handle3 = Subscribers.Add(&Calls3, &CountCall);
+        TestEqual("Hole reused", Handle3.Index, Handle1.Index);
+
+        TestFalse("Stale handle removed", Subscribers.Remove(Handle1));
+        Subscribers.Broadcast(nullptr, nullptr);
+
+        TestEqual("Num", Subscribers.Num(), 2);
+        TestEqual("Calls3", Calls3, 1);
+    });
+
+    It("Should Not Notify Subscriber Added Into Hole During Broadcast", [this]()
+    {
+        struct FAdder
+        {
+            FViewModelSubscribers* Subscribers;
+            FViewModelSubscriptionHandle RemovedHandle;
+            int32 Calls = 0;
+        };
+
+        FViewModelSubscribers Subscribers;
+        int32 Calls = 0;
+
+        FAdder Adder{ &Subscribers };
+        Subscribers.Add(&Adder, [](void* Owner, UBaseViewModel*, const FViewModelPropertyBase*)
+        {
+            FAdder* Adder = static_cast<FAdder*>(Owner);
+            Adder->Subscribers->Remove(Adder->RemovedHandle);
+            Adder->Subscribers->Add(&Adder->Calls, &CountCall);
+        });
+        Adder.RemovedHandle = Subscribers.Add(&Calls, &CountCall);
+
+        Subscribers.Broadcast(nullptr, nullptr);
+
+        TestEqual("Num", Subscribers.Num(), 2);
+        TestEqual("Added Calls", Adder.Calls, 0);
+    });
+}
+
+void FViewModelSubscribersSpec::CountCall(void* Owner, UBaseViewModel* ViewModel, const FViewModelPropertyBase* Property)
+{
+    (*static_cast<int32*>(Owner))++;
+}
+
+void FViewModelSubscribersBenchmarkSpec::Define()
+{
+    It("Should Compare With Multicast Delegate", [this]()
+    {
+        const FViewModelPropertyBase* Property = UTestBaseViewModel::IntValueProperty();
+        FCounter Counter;
+
+        // multicast delegate
+        {
+            TArray<UBaseViewModel::FPropertyChangedDelegate> Delegates;
+            Delegates.SetNum(NumLists);
+
+            double StartTime = FPlatformTime::Seconds();
+            for (UBaseViewModel::FPropertyChangedDelegate& Delegate : Delegates)
+            {
+                Delegate.AddRaw(&Counter, &FCounter::OnPropertyChanged);
+            }
+            AddTiming(TEXT("Delegate Subscribe"), StartTime);
+
+            StartTime = FPlatformTime::Seconds();
+            for (int32 Index = 0; Index < NumBroadcasts; ++Index)
+            {
+                for (const UBaseViewModel::FPropertyChangedDelegate& Delegate : Delegates)
+                {
+                    Delegate.Broadcast(Property);
+                }
+            }
+            AddTiming(TEXT("Delegate Broadcast"), StartTime);
+
+            StartTime = FPlatformTime::Seconds();
+            for (UBaseViewModel::FPropertyChangedDelegate& Delegate : Delegates)
+            {
+                Delegate.RemoveAll(&Counter);
+            }
+            AddTiming(TEXT("Delegate Unsubscribe"), StartTime);
+        }
+
+        // intrusive list
+        {
+            TArray<FViewModelSubscribers> Lists;
+            TArray<FViewModelSubscriptionHandle> Handles;
+            Lists.SetNum(NumLists);
+            Handles.SetNum(NumLists);
+
+            double StartTime = FPlatformTime::Seconds();
+            for (int32 Index = 0; Index < NumLists; ++Index)
+            {
+                Handles[Index] = Lists[Index].Add(&Counter, [](void* Owner, UBaseViewModel*, const FViewModelPropertyBase* Property)
+                {
+                    static_cast<FCounter*>(Owner)->OnPropertyChanged(Property);
+                });
+            }
+            AddTiming(TEXT("Intrusive Subscribe"), StartTime);
+
+            StartTime = FPlatformTime::Seconds();
+            for (int32 Index = 0; Index < NumBroadcasts; ++Index)
+            {
+                for (const FViewModelSubscribers& List : Lists)
+                {
+                    List.Broadcast(nullptr, Property);
+                }
+            }
+            AddTiming(TEXT("Intrusive Broadcast"), StartTime);
+
+            StartTime = FPlatformTime::Seconds();
+            for (int32 Index = 0; Index < NumLists; ++Index)
+            {
+                Lists[Index].Remove(Handles[Index]);
+            }
+            AddTiming(TEXT("Intrusive Unsubscribe"), StartTime);
+        }
+
+        TestEqual("Calls", Counter.Calls, NumLists * NumBroadcasts * 2);
+    });
+}
+
+void FViewModelSubscribersBenchmarkSpec::AddTiming(const TCHAR* Name, double StartTime)
+{
+    AddInfo(FString::Printf(TEXT("%s: %.3f ms"), Name, (FPlatformTime::Seconds() - StartTime) * 1000.0));
+}
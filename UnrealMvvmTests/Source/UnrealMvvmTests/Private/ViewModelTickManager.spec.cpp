@@ -0,0 +1,127 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Mvvm/ViewModelTickManager.h"
+#include "TickTestViewModel.h"
+
+BEGIN_DEFINE_SPEC(FViewModelTickManagerSpec, "UnrealMvvm.ViewModelTickManager", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+static void OnPropertyChanged(void* Owner, UBaseViewModel* ViewModel, const FViewModelPropertyBase* Property) {}
+END_DEFINE_SPEC(FViewModelTickManagerSpec)
+
+void FViewModelTickManagerSpec::Define()
+{
+    It("Should Tick Only ViewModels With Connected Views", [this]()
+    {
+        UTickTestViewModel* ViewModel = NewObject<UTickTestViewModel>();
+        ViewModel->SetTickRate(EViewModelTickRate::EveryFrame);
+
+        FViewModelTickManager::Get().Tick(0.1f);
+        TestEqual("NumTicks", ViewModel->NumTicks, 0);
+
+        UBaseViewModel::FSubscriptionHandle Handle = ViewModel->Subscribe(this, &OnPropertyChanged);
+
+        FViewModelTickManager::Get().Tick(0.1f);
+        TestEqual("NumTicks", ViewModel->NumTicks, 1);
+
+        ViewModel->Unsubscribe(Handle);
+
+        FViewModelTickManager::Get().Tick(0.1f);
+        TestEqual("NumTicks", ViewModel->NumTicks, 1);
+    });
+
+    It("Should Tick With Configured Rate", [this]()
+    {
+        UTickTestViewModel* ViewModel = NewObject<UTickTestViewModel>();
+        UBaseViewModel::FSubscriptionHandle Handle = ViewModel->Subscribe(this, &OnPropertyChanged);
+        ViewModel->SetTickRate(EViewModelTickRate::TenHz);
+
+        FViewModelTickManager::Get().Tick(0.06f);
+        TestEqual("NumTicks", ViewModel->NumTicks, 0);
+
+        FViewModelTickManager::Get().Tick(0.06f);
+        TestEqual("NumTicks", ViewModel->NumTicks, 1);
+        TestEqual("Time", ViewModel->GetTime(), 0.12f);
+
+        ViewModel->SetTickRate(EViewModelTickRate::None);
+
+        FViewModelTickManager::Get().Tick(1.f);
+        TestEqual("NumTicks", ViewModel->NumTicks, 1);
+
+        ViewModel->Unsubscribe(Handle);
+    });
+
+    It("Should Report Class Stats", [this]()
+    {
+        UTickTestViewModel* First = NewObject<UTickTestViewModel>();
+        UTickTestViewModel* Second = NewObject<UTickTestViewModel>();
+        First->SetTickRate(EViewModelTickRate::EveryFrame);
+        Second->SetTickRate(EViewModelTickRate::EveryFrame);
+
+        UBaseViewModel::FSubscriptionHandle FirstHandle = First->Subscribe(this, &OnPropertyChanged);
+        UBaseViewModel::FSubscriptionHandle SecondHandle = Second->Subscribe(this, &OnPropertyChanged);
+
+        FViewModelTickManager::Get().ResetClassStats();
+        FViewModelTickManager::Get().Tick(0.f);
+
+        TArray<FViewModelTickManager::FClassStats> Stats = FViewModelTickManager::Get().GetClassStats();
+        const FViewModelTickManager::FClassStats* ClassStats = Stats.FindByPredicate([](const FViewModelTickManager::FClassStats& Item)
+        {
+            return Item.Class == UTickTestViewModel::StaticClass() && Item.TickRate == EViewModelTickRate::EveryFrame;
+        });
+
+        if (TestNotNull("ClassStats", ClassStats))
+        {
+            TestEqual("NumViewModels", ClassStats->NumViewModels, 2);
+            TestEqual("NumTicks", ClassStats->NumTicks, (uint64)1);
+        }
+
+        First->Unsubscribe(FirstHandle);
+        Second->Unsubscribe(SecondHandle);
+    });
+
+    It("Should Keep Class Stats After Last ViewModel Is Removed", [this]()
+    {
+        UTickTestViewModel* ViewModel = NewObject<UTickTestViewModel>();
+        ViewModel->SetTickRate(EViewModelTickRate::OneHz);
+
+        UBaseViewModel::FSubscriptionHandle Handle = ViewModel->Subscribe(this, &OnPropertyChanged);
+        FViewModelTickManager::Get().Tick(1.f);
+        ViewModel->Unsubscribe(Handle);
+
+        TArray<FViewModelTickManager::FClassStats> Stats = FViewModelTickManager::Get().GetClassStats();
+        const FViewModelTickManager::FClassStats* ClassStats = Stats.FindByPredicate([](const FViewModelTickManager::FClassStats& Item)
+        {
+            return Item.Class == UTickTestViewModel::StaticClass() && Item.TickRate == EViewModelTickRate::OneHz;
+        });
+
+        if (TestNotNull("ClassStats", ClassStats))
+        {
+            TestEqual("NumViewModels", ClassStats->NumViewModels, 0);
+            TestTrue("NumTicks", ClassStats->NumTicks > 0);
+        }
+    });
+
+    It("Should Keep Ticking Remaining ViewModels After Remove", [this]()
+    {
+        TArray<UTickTestViewModel*> ViewModels;
+        TArray<UBaseViewModel::FSubscriptionHandle> Handles;
+
+        for (int32 Index = 0; Index < 3; ++Index)
+        {
+            UTickTestViewModel* ViewModel = ViewModels.Add_GetRef(NewObject<UTickTestViewModel>());
+            ViewModel->SetTickRate(EViewModelTickRate::EveryFrame);
+            Handles.Add(ViewModel->Subscribe(this, &OnPropertyChanged));
+        }
+
+        // first one is replaced by the last one inside bucket
+        ViewModels[0]->Unsubscribe(Handles[0]);
+        ViewModels[1]->Unsubscribe(Handles[1]);
+        FViewModelTickManager::Get().Tick(0.f);
+
+        TestEqual("Removed First NumTicks", ViewModels[0]->NumTicks, 0);
+        TestEqual("Removed Second NumTicks", ViewModels[1]->NumTicks, 0);
+        TestEqual("Remaining NumTicks", ViewModels[2]->NumTicks, 1);
+
+        ViewModels[2]->Unsubscribe(Handles[2]);
+    });
+}
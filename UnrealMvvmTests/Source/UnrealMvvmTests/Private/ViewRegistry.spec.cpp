@@ -3,6 +3,9 @@
 #include "Misc/AutomationTest.h"
 
 #include "Blueprint/UserWidget.h"
+#include "Mvvm/Impl/BaseView/ViewRegistry.h"
+#include "Mvvm/Impl/Binding/ViewModelDynamicBinding.h"
+#include "TestBaseWidgetView.h"
 
 BEGIN_DEFINE_SPEC(FViewRegistrySpec, "UnrealMvvm.ViewRegistry", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
 END_DEFINE_SPEC(FViewRegistrySpec)
@@ -15,4 +18,40 @@ void FViewRegistrySpec::Define()
 
         TestNotNull("View Class", Class);
     });
+
+    Describe("Blueprint Functions", [this]
+    {
+        using namespace UnrealMvvm_Impl;
+
+        It("Should resolve binding handlers of Blueprint class", [this]
+        {
+            UClass* Class = StaticLoadClass(UUserWidget::StaticClass(), nullptr, TEXT("/UnrealMvvmTests/WidgetView/BP_TestWidgetView_BindingWorker.BP_TestWidgetView_BindingWorker_C"));
+            const FViewRegistry::FBlueprintFunctions& Functions = FViewRegistry::GetBlueprintFunctions(Class);
+
+            if (TestNotNull("DynamicBinding", Functions.DynamicBinding))
+            {
+                TestEqual("Num handlers", Functions.BindingHandlers.Num(), Functions.DynamicBinding->BlueprintBindings.Num());
+                TestFalse("Has null handler", Functions.BindingHandlers.Contains(nullptr));
+            }
+        });
+
+        It("Should return same entry for same class", [this]
+        {
+            UClass* Class = StaticLoadClass(UUserWidget::StaticClass(), nullptr, TEXT("/UnrealMvvmTests/WidgetView/BP_TestWidgetView_BindingWorker.BP_TestWidgetView_BindingWorker_C"));
+
+            const FViewRegistry::FBlueprintFunctions& First = FViewRegistry::GetBlueprintFunctions(Class);
+            const FViewRegistry::FBlueprintFunctions& Second = FViewRegistry::GetBlueprintFunctions(Class);
+
+            TestEqual("Entry", &First, &Second);
+        });
+
+        It("Should resolve nothing for native class", [this]
+        {
+            const FViewRegistry::FBlueprintFunctions& Functions = FViewRegistry::GetBlueprintFunctions(UTestBaseWidgetViewPure::StaticClass());
+
+            TestNull("ViewModelChanged", Functions.ViewModelChanged);
+            TestNull("DynamicBinding", Functions.DynamicBinding);
+            TestEqual("Num handlers", Functions.BindingHandlers.Num(), 0);
+        });
+    });
 }
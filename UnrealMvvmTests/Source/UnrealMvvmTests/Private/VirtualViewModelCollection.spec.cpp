@@ -0,0 +1,210 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Mvvm/VirtualViewModelCollection.h"
+#include "UtilsTestViewModel.h"
+
+BEGIN_DEFINE_SPEC(FVirtualViewModelCollectionSpec, "UnrealMvvm.VirtualViewModelCollection", EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::EngineFilter)
+using FCollection = TVirtualViewModelCollection<UUtilsTestViewModel>;
+static constexpr int32 NumModels = 100000;
+TArray<FString> Models;
+int32 NumCreated = 0;
+int32 NumSetterCalls = 0;
+TUniquePtr<FCollection> MakeCollection();
+END_DEFINE_SPEC(FVirtualViewModelCollectionSpec)
+
+void FVirtualViewModelCollectionSpec::Define()
+{
+    BeforeEach([this]()
+    {
+        Models.SetNum(NumModels);
+        for (int32 Index = 0; Index < NumModels; ++Index)
+        {
+            Models[Index] = FString::FromInt(Index);
+        }
+
+        NumCreated = 0;
+        NumSetterCalls = 0;
+    });
+
+    AfterEach([this]()
+    {
+        Models.Empty();
+    });
+
+    It("Should Materialize Only Visible Range And Margins", [this]()
+    {
+        TUniquePtr<FCollection> Collection = MakeCollection();
+        Collection->SetPrefetchMargin(2);
+        Collection->SetVisibleRange(10, 5);
+
+        TestEqual("Num", Collection->Num(), NumModels);
+        TestEqual("NumMaterialized", Collection->GetNumMaterialized(), 9);
+        TestNull("Before Margin", Collection->GetViewModel(7));
+        TestNull("After Margin", Collection->GetViewModel(17));
+
+        for (int32 Index = 8; Index < 17; ++Index)
+        {
+            UUtilsTestViewModel* ViewModel = Collection->GetViewModel(Index);
+            if (TestNotNull("ViewModel", ViewModel))
+            {
+                TestEqual("Model", ViewModel->Model, Models[Index]);
+            }
+        }
+    });
+
+    It("Should Recycle ViewModels When Range Changes", [this]()
+    {
+        TUniquePtr<FCollection> Collection = MakeCollection();
+        Collection->SetVisibleRange(0, 10);
+        Collection->SetVisibleRange(5, 10);
+        Collection->SetVisibleRange(50000, 10);
+
+        TestEqual("NumCreated", NumCreated, 10);
+        TestEqual("NumMaterialized", Collection->GetNumMaterialized(), 10);
+        TestEqual("Model", Collection->GetViewModel(50000)->Model, Models[50000]);
+    });
+
+    It("Should Keep ViewModels Of Remaining Models When Scrolling", [this]()
+    {
+        TUniquePtr<FCollection> Collection = MakeCollection();
+        Collection->SetVisibleRange(0, 10);
+        UUtilsTestViewModel* ViewModel = Collection->GetViewModel(9);
+
+        for (int32 First = 1; First < 10; ++First)
+        {
+            NumSetterCalls = 0;
+            Collection->SetVisibleRange(First, 10);
+            TestEqual("NumSetterCalls", NumSetterCalls, 1);
+        }
+
+        TestEqual("NumCreated", NumCreated, 10);
+        TestEqual("Same ViewModel", Collection->GetViewModel(9), ViewModel);
+
+        for (int32 Index = 9; Index < 19; ++Index)
+        {
+            UUtilsTestViewModel* Current = Collection->GetViewModel(Index);
+            if (TestNotNull("ViewModel", Current))
+            {
+                TestEqual("Model", Current->Model, Models[Index]);
+            }
+        }
+
+        // growing range keeps ViewModels that are already assigned
+        NumSetterCalls = 0;
+        Collection->SetVisibleRange(9, 15);
+        TestEqual("NumSetterCalls after grow", NumSetterCalls, 5);
+        TestEqual("Same ViewModel after grow", Collection->GetViewModel(9), ViewModel);
+        TestEqual("Model after grow", Collection->GetViewModel(23)->Model, Models[23]);
+    });
+
+    It("Should Clamp Range To Number Of Models", [this]()
+    {
+        TUniquePtr<FCollection> Collection = MakeCollection();
+        Collection->SetPrefetchMargin(5);
+        Collection->SetVisibleRange(NumModels - 3, 10);
+
+        TestEqual("NumMaterialized", Collection->GetNumMaterialized(), 8);
+
+        Models.SetNum(NumModels - 5);
+        Collection->SetNum(Models.Num());
+
+        TestEqual("NumMaterialized", Collection->GetNumMaterialized(), 3);
+        TestNull("Removed Model", Collection->GetViewModel(NumModels - 3));
+    });
+
+    It("Should Fetch Missing Models", [this]()
+    {
+        Models.Reset();
+        Models.SetNum(NumModels);
+
+        int32 FetchFirst = INDEX_NONE, FetchCount = 0, NumFetches = 0;
+
+        TUniquePtr<FCollection> Collection = MakeCollection();
+        Collection->SetFetchModels([&](int32 FirstIndex, int32 Count)
+        {
+            FetchFirst = FirstIndex;
+            FetchCount = Count;
+            NumFetches++;
+        });
+        Collection->SetVisibleRange(100, 10);
+        Collection->SetVisibleRange(102, 10);
+
+        TestEqual("NumFetches", NumFetches, 2);
+        TestEqual("FetchFirst", FetchFirst, 110);
+        TestEqual("FetchCount", FetchCount, 2);
+        TestNull("Pending ViewModel", Collection->GetViewModel(105));
+
+        for (int32 Index = 100; Index < 112; ++Index)
+        {
+            Models[Index] = FString::FromInt(Index);
+        }
+        Collection->NotifyModelsFetched(100, 12);
+
+        TestEqual("Model", Collection->GetViewModel(105)->Model, Models[105]);
+        TestEqual("NumFetches", NumFetches, 2);
+    });
+
+    It("Should Fetch Models Again After They Leave Range", [this]()
+    {
+        Models.Reset();
+        Models.SetNum(NumModels);
+
+        int32 FetchFirst = INDEX_NONE, NumFetches = 0;
+
+        TUniquePtr<FCollection> Collection = MakeCollection();
+        Collection->SetFetchModels([&](int32 FirstIndex, int32 Count)
+        {
+            FetchFirst = FirstIndex;
+            NumFetches++;
+        });
+
+        Collection->SetVisibleRange(100, 10);
+        Collection->SetVisibleRange(200, 10);
+        Collection->SetVisibleRange(100, 10);
+
+        TestEqual("NumFetches", NumFetches, 3);
+        TestEqual("FetchFirst", FetchFirst, 100);
+    });
+
+    It("Should Call Setter Once Per ViewModel On Refresh", [this]()
+    {
+        TUniquePtr<FCollection> Collection = MakeCollection();
+        Collection->SetVisibleRange(0, 10);
+
+        NumSetterCalls = 0;
+        Collection->Refresh();
+        TestEqual("NumSetterCalls", NumSetterCalls, 10);
+
+        Models.SetNum(8);
+        Models[3].Reset();
+        NumSetterCalls = 0;
+        Collection->SetNum(Models.Num());
+        TestEqual("NumSetterCalls with missing Model", NumSetterCalls, 8);
+    });
+}
+
+TUniquePtr<FVirtualViewModelCollectionSpec::FCollection> FVirtualViewModelCollectionSpec::MakeCollection()
+{
+    TUniquePtr<FCollection> Collection = MakeUnique<FCollection>(
+        [this](UUtilsTestViewModel* ViewModel, int32 ModelIndex)
+        {
+            NumSetterCalls++;
+
+            if (Models[ModelIndex].IsEmpty())
+            {
+                return false;
+            }
+
+            ViewModel->SetModel(Models[ModelIndex]);
+            return true;
+        },
+        [this]()
+        {
+            NumCreated++;
+            return NewObject<UUtilsTestViewModel>();
+        });
+
+    Collection->SetNum(Models.Num());
+    return Collection;
+}
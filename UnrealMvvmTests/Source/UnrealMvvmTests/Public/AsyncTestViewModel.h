@@ -0,0 +1,27 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Mvvm/BaseViewModel.h"
+#include "Mvvm/AsyncViewModelValue.h"
+#include "AsyncTestViewModel.generated.h"
+
+UCLASS()
+class UAsyncTestViewModel : public UBaseViewModel
+{
+    GENERATED_BODY()
+
+    VM_PROP_AG_AS(TOptional<int32>, Value, public, private);
+
+public:
+    TAsyncViewModelValue<UAsyncTestViewModel, int32> ValueRequest{ ValueProperty() };
+
+protected:
+    void SubscriptionStatusChanged(bool bHasConnectedViews) override
+    {
+        if (!bHasConnectedViews)
+        {
+            ValueRequest.Cancel();
+        }
+    }
+};
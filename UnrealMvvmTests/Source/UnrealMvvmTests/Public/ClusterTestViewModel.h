@@ -0,0 +1,54 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Mvvm/BaseViewModel.h"
+#include "ClusterTestViewModel.generated.h"
+
+UCLASS()
+class UClusterTestItemViewModel : public UBaseViewModel
+{
+    GENERATED_BODY()
+
+    VM_PROP_AG_AS(int32, IntValue, public, public);
+};
+
+UCLASS()
+class UClusterTestViewModel : public UBaseViewModel
+{
+    GENERATED_BODY()
+
+    VM_PROP_AG_AS(int32, IntValue, public, public);
+    VM_PROP_AG_AS(TArray<TObjectPtr<UClusterTestItemViewModel>>, Items, public, public);
+};
+
+/* Holds object reference outside of ViewModel properties, so it cannot be clustered */
+UCLASS()
+class UClusterTestPlainReferenceViewModel : public UBaseViewModel
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    TObjectPtr<UClusterTestItemViewModel> Item;
+};
+
+/* Plain object that holds reference without notifying anyone when it changes */
+UCLASS()
+class UClusterTestPlainObject : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    TObjectPtr<UClusterTestItemViewModel> Item;
+};
+
+/* Holds plain object with its own references in ViewModel property, so it cannot be clustered */
+UCLASS()
+class UClusterTestPlainObjectViewModel : public UBaseViewModel
+{
+    GENERATED_BODY()
+
+    VM_PROP_AG_AS(TObjectPtr<UClusterTestPlainObject>, Object, public, public);
+};
@@ -35,6 +35,19 @@ public:
     }
 };
 
+USTRUCT()
+struct FGCTestPlainStruct
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    int32 IntValue = 0;
+
+    UPROPERTY()
+    FVector2D VectorValue = FVector2D::ZeroVector;
+};
+
 template <>
 struct TViewModelPropertyTypeTraits<FGCTestStruct> : public TViewModelPropertyTypeTraitsBase<FGCTestStruct>
 {
@@ -73,6 +86,9 @@ class UGCTestViewModel : public UBaseViewModel
     VM_PROP_AG_AS(TSet<UObject*>, PointerSet, public, public);
     VM_PROP_AG_AS(TSet<FGCTestStruct>, StructSet, public, public);
 
+    VM_PROP_AG_AS(FGCTestPlainStruct, PlainStruct, public, public);
+    VM_PROP_AG_AS(TArray<FGCTestPlainStruct>, PlainStructArray, public, public);
+
 public:
     UGCTestObject* PlainField;
 };
@@ -0,0 +1,31 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "UObject/Object.h"
+#include "PropertyBindingTestTarget.generated.h"
+
+UCLASS()
+class UPropertyBindingTestTarget : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY()
+    int32 IntValue = 0;
+
+    UPROPERTY()
+    double DoubleValue = 0.0;
+
+    UPROPERTY()
+    FText TextValue;
+
+    UPROPERTY()
+    TObjectPtr<UPropertyBindingTestTarget> Child;
+
+    /* Mimics dispatch event of Blueprint compiled with single dispatch function */
+    UFUNCTION()
+    void Dispatch(int32 BindingIndex) { DispatchedIndices.Add(BindingIndex); }
+
+    TArray<int32> DispatchedIndices;
+};
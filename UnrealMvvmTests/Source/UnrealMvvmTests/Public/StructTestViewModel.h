@@ -0,0 +1,39 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Mvvm/BaseStructViewModel.h"
+#include "Mvvm/BaseViewModel.h"
+#include "Templates/SharedPointer.h"
+#include "StructTestViewModel.generated.h"
+
+class FStructTestViewModel : public FBaseStructViewModel
+{
+    VM_STRUCT_BODY(FStructTestViewModel);
+
+    VM_PROP_AG_AS(int32, IntValue, public, public);
+    VM_PROP_AG_AS(FText, TextValue, public, public);
+    VM_PROP_AG_AS(float, FloatValue, public, public);
+    VM_PROP_AG_AS(TSoftObjectPtr<UObject>, SoftObjectValue, public, public);
+    VM_PROP_MG_NF(int32, DoubledValue);
+    VM_PROP_AG_AS(int32, PrivateSetterValue);
+
+public:
+    using FBaseStructViewModel::HasConnectedViews;
+
+    TOptional<bool> LastSubscriptionStatus;
+
+protected:
+    void SubscriptionStatusChanged(bool bHasConnectedViews) override
+    {
+        LastSubscriptionStatus = bHasConnectedViews;
+    }
+};
+
+UCLASS()
+class UStructOwnerTestViewModel : public UBaseViewModel
+{
+    GENERATED_BODY()
+
+    VM_PROP_AG_AS(TSharedPtr<FStructTestViewModel>, Row, public, public);
+};
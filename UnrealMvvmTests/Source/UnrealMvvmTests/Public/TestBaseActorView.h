@@ -39,6 +39,47 @@ protected:
     }
 };
 
+/* Same as ATestBaseActorViewPure, but keeps its bindings in UActorViewSubsystem */
+UCLASS()
+class ATestBaseActorViewSubsystem : public AActor, public TBaseView<ATestBaseActorViewSubsystem, UTestBaseViewModel>
+{
+    GENERATED_BODY()
+
+public:
+    static constexpr EActorViewStorage ViewStorage = EActorViewStorage::Subsystem;
+
+    int32 MyValue = 0;
+
+    /* Set to View from BeginPlay when not null */
+    ViewModelType* BeginPlayViewModel = nullptr;
+
+protected:
+    void BeginPlay() override
+    {
+        Super::BeginPlay();
+        UActorViewSubsystem::ViewBeginPlay(this);
+
+        if (BeginPlayViewModel)
+        {
+            SetViewModel(BeginPlayViewModel);
+        }
+    }
+
+    void EndPlay(const EEndPlayReason::Type EndPlayReason) override
+    {
+        UActorViewSubsystem::ViewEndPlay(this);
+        Super::EndPlay(EndPlayReason);
+    }
+
+    void BindProperties() override
+    {
+        Bind(this, ViewModelType::IntValueProperty(), [this](const int32& InValue)
+        {
+            MyValue = InValue;
+        });
+    }
+};
+
 /* Same as ATestBaseActorViewPure, but without registered bindings */
 UCLASS()
 class ATestBaseActorViewPureNoBind : public AActor, public TBaseView<ATestBaseActorViewPureNoBind, UTestBaseViewModel>
@@ -0,0 +1,26 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Mvvm/BaseViewModel.h"
+#include "TickTestViewModel.generated.h"
+
+UCLASS()
+class UTickTestViewModel : public UBaseViewModel
+{
+    GENERATED_BODY()
+
+    VM_PROP_AG_AS(float, Time, public, private);
+
+public:
+    using UBaseViewModel::SetTickRate;
+
+    int32 NumTicks = 0;
+
+protected:
+    void TickViewModel(float DeltaTime) override
+    {
+        NumTicks++;
+        SetTime(GetTime() + DeltaTime);
+    }
+};
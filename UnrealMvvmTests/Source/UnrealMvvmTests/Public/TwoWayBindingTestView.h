@@ -0,0 +1,90 @@
+// Copyright Andrei Sudarikov. All Rights Reserved.
+
+#pragma once
+
+#include "Mvvm/BaseView.h"
+#include "TestBaseViewModel.h"
+#include "TwoWayBindingTestView.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FTwoWayTestValueChanged, int32, Value);
+
+/* Mimics UMG control that notifies about changes made by user */
+UCLASS()
+class UTwoWayTestControl : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    void SetValue(int32 InValue)
+    {
+        Value = InValue;
+        ++NumSetValueCalls;
+    }
+
+    UPROPERTY()
+    FTwoWayTestValueChanged OnValueChanged;
+
+    int32 Value = 0;
+    int32 NumSetValueCalls = 0;
+};
+
+/* ViewModel whose Setter keeps value in range [0, 10] */
+UCLASS()
+class UTwoWayClampingTestViewModel : public UBaseViewModel
+{
+    GENERATED_BODY()
+
+    VM_PROP_AG_MS(int32, ClampedValue, public, public);
+};
+
+inline void UTwoWayClampingTestViewModel::SetClampedValue(int32 InNewValue)
+{
+    if (TrySetValue(ClampedValueField, FMath::Clamp(InNewValue, 0, 10)))
+    {
+        RaiseChanged(ClampedValueProperty());
+    }
+}
+
+/* Test View with two-way binding */
+UCLASS()
+class ATwoWayBindingTestView : public AActor, public TBaseView<ATwoWayBindingTestView, UTestBaseViewModel>
+{
+    GENERATED_BODY()
+
+public:
+    ATwoWayBindingTestView()
+    {
+        Control = CreateDefaultSubobject<UTwoWayTestControl>(TEXT("Control"));
+    }
+
+    UPROPERTY()
+    TObjectPtr<UTwoWayTestControl> Control;
+
+protected:
+    void BindProperties() override
+    {
+        BindTwoWay(this, ViewModelType::IntValueProperty(), Control, &UTwoWayTestControl::SetValue, &UTwoWayTestControl::OnValueChanged);
+    }
+};
+
+/* Test View with two-way binding to a clamped property */
+UCLASS()
+class ATwoWayClampingTestView : public AActor, public TBaseView<ATwoWayClampingTestView, UTwoWayClampingTestViewModel>
+{
+    GENERATED_BODY()
+
+public:
+    ATwoWayClampingTestView()
+    {
+        Control = CreateDefaultSubobject<UTwoWayTestControl>(TEXT("Control"));
+    }
+
+    UPROPERTY()
+    TObjectPtr<UTwoWayTestControl> Control;
+
+protected:
+    void BindProperties() override
+    {
+        BindTwoWay(this, ViewModelType::ClampedValueProperty(), Control, &UTwoWayTestControl::SetValue, &UTwoWayTestControl::OnValueChanged);
+    }
+};